@@ -10,6 +10,61 @@
 #ifndef INC_DISPLAY_H_
 #define INC_DISPLAY_H_
 
+#include "epaper.h"
 
+#define DISP_MAX_WIDGETS 16
+#define DISP_TEXT_MAX 20
+
+#define DISP_TEXT   1
+#define DISP_NUMBER 2
+#define DISP_ICON   3
+#define DISP_BAR    4
+#define DISP_CHART  5
+
+#define DISP_DIRTY 0x01
+
+// retained widget; X, Y, W, H is the bounding box in EPD_Paint coordinates
+// (0-based), the box is cleared before the widget is drawn again
+typedef struct {
+  uint8_t Type;
+  uint8_t Flags;
+  uint8_t Size;      // font size (text, number)
+  uint8_t Len;       // characters (text, number)
+  uint8_t Decimals;  // number: fixed point digits after the dot
+  uint8_t Style;     // text: EPD_TEXT_* alignment and spacing
+  uint16_t X, Y, W, H;
+  uint16_t Color;
+  int32_t Value;     // number, bar
+  int32_t Min, Max;  // bar, chart range
+  uint16_t DrawnX0, DrawnX1; // text: columns drawn last time, none while equal
+  uint16_t Count;    // chart samples
+  const void *Data;  // icon (EPD_ASSET), chart samples (int16_t)
+  char Text[DISP_TEXT_MAX + 1]; // text, number unit
+} DISP_WIDGET;
+
+void disp_init(void);
+int8_t disp_add_text(uint16_t x, uint16_t y, uint8_t len, uint8_t size, uint16_t color);
+int8_t disp_add_number(uint16_t x, uint16_t y, uint8_t len, uint8_t decimals, uint8_t size,
+    uint16_t color);
+// icons are opaque, the box is the size of the asset
+int8_t disp_add_icon(uint16_t x, uint16_t y, const EPD_ASSET *icon);
+int8_t disp_add_bar(uint16_t x, uint16_t y, uint16_t w, uint16_t h, int32_t min, int32_t max,
+    uint16_t color);
+int8_t disp_add_chart(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const int16_t *samples,
+    int32_t min, int32_t max, uint16_t color);
+
+// setters only invalidate the widget when the value actually changes
+void disp_set_text(int8_t id, const char *text);
+void disp_set_style(int8_t id, uint8_t style);
+void disp_set_number(int8_t id, int32_t value);
+void disp_set_unit(int8_t id, const char *unit);
+void disp_set_icon(int8_t id, const EPD_ASSET *icon);
+void disp_set_bar(int8_t id, int32_t value);
+void disp_set_chart(int8_t id, uint16_t count);
+void disp_invalidate(int8_t id);
+void disp_invalidate_all(void);
+
+uint8_t disp_render(void);
+void disp_refresh(void);
 
 #endif /* INC_DISPLAY_H_ */
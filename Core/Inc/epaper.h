@@ -12,22 +12,35 @@ extern "C"
 //#include "stm32f1xx_hal_gpio.h"
 //#include "stm32f1xx_hal_spi.h"
 #include "main.h"
+#include "epdfont.h"
 
-#define EPD_29
+// panel, uncomment one or pass it on the compiler command line
+//#define EPD_29
 //#define EPD_213
 
 #if (!defined EPD_29) && (!defined EPD_213)
-#error EPD Type Undefine
+#define EPD_29
+#endif
+
+#if (defined EPD_29) && (defined EPD_213)
+#error EPD Type Defined Twice
 #endif
 
+// geometry in pixels; EPD_RAM_X0 is the first controller RAM byte column
+// and EPD_RAM_Y0 the first gate the panel is wired to. Init sequence,
+// waveforms and timings are in the EPD_PANEL of epaper.c
 #ifdef EPD_29
 #define EPD_W 128
 #define EPD_H 296
+#define EPD_RAM_X0 0
+#define EPD_RAM_Y0 0
 #endif
 
 #ifdef EPD_213
 #define EPD_W 122
-#define EPD_H 250&
+#define EPD_H 250
+#define EPD_RAM_X0 0
+#define EPD_RAM_Y0 0
 #endif
 
 #define EPD_OK 0
@@ -41,16 +54,42 @@ extern "C"
 #define EPD_COLOR_WHITE 0xFF
 #define EPD_COLOR_BLACK 0x00
 #define EPD_COLOR_RED EPD_COLOR_BLACK
+// 4-gray images only (epd_paint_newimage_gray), 1bpp images round them
+// to white and black
+#define EPD_COLOR_LIGHTGRAY 0xAA
+#define EPD_COLOR_DARKGRAY 0x55
+// background of opaque text and bitmaps: the opposite of the color rounded
+// to black or white
+#define EPD_COLOR_BACK(c) \
+  ((c) == EPD_COLOR_BLACK || (c) == EPD_COLOR_DARKGRAY ? EPD_COLOR_WHITE : EPD_COLOR_BLACK)
+
+// line patterns, 16 pixels repeating from the start of the line, bit 0 first
+#define EPD_LINE_SOLID 0xFFFF
+#define EPD_LINE_DOTTED 0x5555
+#define EPD_LINE_DASHED 0x0F0F
 
 #define EPD_FONT_SIZE8x6 (8)
 #define EPD_FONT_SIZE12x6 (12)
 #define EPD_FONT_SIZE16x8 (16)
 #define EPD_FONT_SIZE24x12 (24)
 
+// epd_paint_drawText() flags
+#define EPD_TEXT_LEFT 0x00
+#define EPD_TEXT_CENTER 0x01
+#define EPD_TEXT_RIGHT 0x02
+#define EPD_TEXT_ALIGN 0x03
+#define EPD_TEXT_WRAP 0x04 // break lines at spaces to fit the box width
+#define EPD_TEXT_PROP 0x08 // proportional advances and kerning
+
+// degree sign of the fonts, "\x7F" "C" in strings
+#define EPD_CHAR_DEGREE 0x7F
+
 #define EPD_DEEPSLEEP_MODE1 (0x01)
 #define EPD_DEEPSLEEP_MODE2 (0x03)
 
 #define EPD_W_BUFF_SIZE ((EPD_W % 8 == 0) ? (EPD_W / 8) : (EPD_W / 8 + 1))
+// row of a 4-gray image, 2 bits per pixel, first pixel in the top bits
+#define EPD_GRAY_BUFF_SIZE (EPD_W_BUFF_SIZE * 2)
 typedef struct {
   uint8_t *Image;
   uint16_t Width;
@@ -61,9 +100,29 @@ typedef struct {
   uint16_t Rotate;
   uint16_t WidthByte;
   uint16_t HeightByte;
+  uint16_t Bpp;         // bits per pixel, 1 or 2 (4-gray)
+  uint16_t BandStart;   // memory rows held by Image, the whole
+  uint16_t BandEnd;     // frame unless epd_paint_setband() was used
+  uint16_t DirtyXStart; // dirty rectangle in memory coordinates,
+  uint16_t DirtyYStart; // empty when DirtyXStart > DirtyXEnd
+  uint16_t DirtyXEnd;
+  uint16_t DirtyYEnd;
 } EPD_PAINT;
 extern EPD_PAINT EPD_Paint;
 
+// bitmap in frame buffer layout for one rotation, see Tools/imgconv.py:
+// Lines memory rows of Bits pixels, each padded to whole bytes, 1 is white;
+// the rows may be one PackBits stream
+typedef struct {
+  uint16_t Width;  // logical size
+  uint16_t Height;
+  uint16_t Rotate; // rotation the rows are laid out for
+  uint16_t Lines;
+  uint16_t Bits;
+  uint16_t Packed; // bytes of PackBits data, 0 for raw rows
+  const uint8_t *Data;
+} EPD_ASSET;
+
 typedef struct {
   GPIO_TypeDef *res_port;
   uint16_t res_pin;
@@ -81,34 +140,100 @@ void epd_io_init(void);
 void epd_io_init_my();
 uint8_t epd_init(void);
 uint8_t epd_init_partial(void);
+void epd_set_temperature(int8_t temp);
 void epd_enter_deepsleepmode(uint8_t mode);
+uint8_t epd_is_hibernating(void);
+uint8_t epd_ram_retained(void);
+// 1 if buffer row y of Image differs from the panel RAM or is unknown
+uint8_t epd_row_changed(const uint8_t *Image, uint16_t y);
 void epd_init_internalTempSensor(void);
 void epd_update(void);
 void epd_update_partial(void);
+// start the waveform and return at once; done() runs from the BUSY falling
+// edge interrupt (EXTI), so the MCU may sleep or enter STOP meanwhile
+void epd_update_async(void (*done)(void));
+void epd_update_partial_async(void (*done)(void));
+uint8_t epd_is_updating(void);
+uint8_t epd_wait_update(void);
+void epd_busy_irq(void);
 void epd_display(uint8_t *Image1, uint8_t *Image2);
 void epd_displayBW(uint8_t *Image);
 void epd_displayBW_partial(uint8_t *Image);
+// 1 when the panel was refreshed, 0 when no row in the area changed
+uint8_t epd_displayBW_partial_area(uint8_t *Image, uint16_t Xstart, uint16_t Ystart,
+    uint16_t Xend, uint16_t Yend);
+uint8_t epd_displayBW_partial_dirty(void);
+// EPD_Paint.Image as a full (partial == 0) or partial update of its dirty
+// area that runs on after the return, 0 when nothing changed; with a second
+// buffer (epd_paint_doublebuffer) the next frame is drawn while the panel
+// refreshes, else it waits for the update like the calls above
+uint8_t epd_displayBW_async(uint8_t partial);
+// strip rendering: EPD_Paint.Image only holds Lines memory rows
+// (Lines * EPD_W_BUFF_SIZE bytes), set up with epd_paint_newimage() on the
+// full frame size and epd_paint_setband(); render() runs once per band
+void epd_displayBW_banded(uint16_t Lines, void (*render)(void));
+void epd_displayBW_partial_banded(uint16_t Lines, void (*render)(void));
 void epd_displayRED(uint8_t *Image);
+// decode an asset straight into the controller RAM selected by cmd (0x24 or
+// 0x26), top left at memory Xstart (a multiple of 8), Ystart; the frame
+// buffer is not touched. 1 if the box does not fit
+uint8_t epd_writeasset(uint8_t cmd, uint16_t Xstart, uint16_t Ystart, const EPD_ASSET *asset);
+// full update with the asset in both RAMs, e.g. a static background
+uint8_t epd_display_asset(uint16_t Xstart, uint16_t Ystart, const EPD_ASSET *asset);
+// 4-gray full update from a 2bpp image (EPD_GRAY_BUFF_SIZE * EPD_H bytes):
+// the high bit of each pixel goes to 0x24, the low bit to 0x26. Both RAMs
+// then hold no BW frame, so the next update should be a full one
+void epd_display_gray(uint8_t *Image);
+void epd_display_gray_banded(uint16_t Lines, void (*render)(void));
 
 void epd_paint_newimage(uint8_t *image, uint16_t Width, uint16_t Height, uint16_t Rotate,
     uint16_t Color);
+void epd_paint_newimage_gray(uint8_t *image, uint16_t Width, uint16_t Height, uint16_t Rotate,
+    uint16_t Color);
 void epd_paint_setpixel(uint16_t Xpoint, uint16_t Ypoint, uint16_t Color);
 void epd_paint_selectimage(uint8_t *image);
+void epd_paint_doublebuffer(uint8_t *image);
 void epd_paint_clear(uint16_t color);
+void epd_paint_setband(uint16_t Start, uint16_t Lines);
+void epd_paint_cleardirty(void);
+uint8_t epd_paint_isdirty(void);
 void epd_paint_drawPoint(uint16_t Xpoint, uint16_t Ypoint, uint16_t Color);
 void epd_paint_drawLine(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend,
     uint16_t Color);
+// clipped to the paint area, the pattern keeps its phase across the clip
+void epd_paint_drawLineStyle(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend,
+    uint16_t Color, uint16_t Pattern);
 void epd_paint_drawRectangle(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend,
     uint16_t Color, uint8_t mode);
 void epd_paint_drawCircle(uint16_t X_Center, uint16_t Y_Center, uint16_t Radius, uint16_t Color,
     uint8_t mode);
+void epd_paint_drawRoundRect(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend,
+    uint16_t Radius, uint16_t Color, uint8_t mode);
 void epd_paint_showChar(uint16_t x, uint16_t y, uint16_t chr, uint16_t size1, uint16_t color);
 void epd_paint_showString(uint16_t x, uint16_t y, uint8_t *chr, uint16_t size1, uint16_t color);
 void epd_paint_showNum(uint16_t x, uint16_t y, uint32_t num, uint16_t len, uint16_t size1,
     uint16_t color);
+// value / 10^decimals, e.g. centi-degrees with decimals 2: -1234 -> "-12.34".
+// Right aligned in width cells (0: no padding, else the low digits are kept
+// when it is too long), followed by unit (may be NULL); cells are drawn
+// opaque. Returns the x after the last cell
+uint16_t epd_paint_showFixed(uint16_t x, uint16_t y, int32_t value, uint8_t decimals,
+    uint8_t width, const char *unit, uint16_t size1, uint16_t color);
+// width of the widest line and height of text laid out as drawText would
+// in a box w pixels wide, without drawing
+void epd_paint_measureText(const char *text, uint16_t w, uint16_t size1, uint8_t flags,
+    uint16_t *width, uint16_t *height);
+// text in the box x, y, w, h: lines end at '\n' (and with EPD_TEXT_WRAP at
+// the spaces that keep them within w), each aligned in w. Glyphs are drawn
+// transparent and only when inside the box; returns the height used
+uint16_t epd_paint_drawText(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const char *text,
+    uint16_t size1, uint16_t color, uint8_t flags);
+#ifdef EPD_FONT_CJK
 void epd_paint_showChinese(uint16_t x, uint16_t y, uint16_t num, uint16_t size1, uint16_t color);
+#endif
 void epd_paint_showPicture(uint16_t x, uint16_t y, uint16_t sizex, uint16_t sizey,
     const uint8_t BMP[], uint16_t Color);
+void epd_paint_showAsset(uint16_t x, uint16_t y, const EPD_ASSET *asset);
 
 #ifdef __cplusplus
 }
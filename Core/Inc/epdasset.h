@@ -0,0 +1,25 @@
+/*
+ * epdasset.h
+ *
+ * Generated by Tools/imgconv.py, do not edit.
+ */
+
+#ifndef __EPDASSET_H
+#define __EPDASSET_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "epaper.h"
+
+extern const EPD_ASSET epd_asset_image1;
+extern const EPD_ASSET epd_asset_image2;
+extern const EPD_ASSET epd_asset_image3;
+extern const EPD_ASSET epd_asset_image4;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,70 @@
+/*
+ * epdprof.h
+ *
+ * Cycle counts of the display pipeline from the DWT counter, built with
+ * -DEPD_PROFILE; otherwise every hook below compiles to nothing. CYCCNT
+ * stops while the core is in STOP mode, so a record that spans a sampler
+ * conversion (sampler_read()) undercounts its waits.
+ */
+
+#ifndef __EPDPROF_H
+#define __EPDPROF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+
+#define EPD_PROF_RECORDS 32
+
+// stages a span of cycles is charged to
+#define EPD_PROF_RENDER 0 // disp_render(), render() of the banded paths
+#define EPD_PROF_SPI 1    // commands and RAM data, bytes counted
+#define EPD_PROF_WAIT 2   // BUSY after a reset or a command, reset pulse
+#define EPD_PROF_UPDATE 3 // epd_wait_update(), charged to the last update
+
+// one update: the work that led up to it since the previous one, and the
+// time it kept the panel and the caller busy
+typedef struct {
+  uint32_t Tick;     // HAL_GetTick() at the update command
+  uint32_t Render;   // cycles per stage
+  uint32_t Spi;
+  uint32_t Wait;     // EPD_PROF_WAIT before, EPD_PROF_UPDATE after the command
+  uint32_t Waveform; // cycles from the update command to BUSY low, 0 while running
+  uint32_t Bytes;    // SPI bytes
+  uint8_t Mode;      // 0x22 display update mode
+} EPD_PROF_RECORD;
+
+#ifdef EPD_PROFILE
+
+#define EPD_PROF_START(t) uint32_t t = DWT->CYCCNT
+#define EPD_PROF_STOP(stage, t, bytes) epd_prof_add(stage, DWT->CYCCNT - (t), bytes)
+
+// enables the cycle counter and empties the ring
+void epd_prof_init(void);
+void epd_prof_add(uint8_t stage, uint32_t cycles, uint32_t bytes);
+void epd_prof_update(uint8_t mode);
+void epd_prof_done(void);
+// the ring, oldest record first, as text lines of cycle counts
+void epd_prof_dump(UART_HandleTypeDef *huart);
+// from the main loop: dumps the ring each time it holds only new records
+void epd_prof_poll(UART_HandleTypeDef *huart);
+
+#else
+
+#define EPD_PROF_START(t)
+#define EPD_PROF_STOP(stage, t, bytes)
+#define epd_prof_init()
+#define epd_prof_update(mode)
+#define epd_prof_done()
+#define epd_prof_dump(huart)
+#define epd_prof_poll(huart)
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef __EPDREFRESH_H
+#define __EPDREFRESH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "epaper.h"
+
+// ghosting budget, kept per band of EPD_H / EPD_REFRESH_REGIONS buffer rows
+#define EPD_REFRESH_REGIONS 8
+#define EPD_REFRESH_MAX_PARTIAL 30 // partial updates touching a region
+#define EPD_REFRESH_MAX_AREA 12    // refreshed pixels, in multiples of the region size
+
+// changes are collected this long before they go out as one update
+#define EPD_REFRESH_BATCH_MS 500
+
+#define EPD_REFRESH_NONE 0
+#define EPD_REFRESH_PARTIAL 1
+#define EPD_REFRESH_FULL 2
+
+// refresh policy for EPD_Paint: the pending changes are its dirty rectangle
+void epd_refresh_init(void);
+void epd_refresh_force_full(void);
+uint8_t epd_refresh_poll(void);
+uint8_t epd_refresh_now(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
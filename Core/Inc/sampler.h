@@ -0,0 +1,45 @@
+/*
+ * sampler.h
+ *
+ * BMP280 in forced mode: one conversion per sampler_read(), the sensor
+ * asleep in between and the MCU in STOP mode while it converts, woken by
+ * the RTC wakeup timer.
+ */
+
+#ifndef __SAMPLER_H
+#define __SAMPLER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+#include "bmp280.h"
+
+// the RTC runs from the LSI, 37 kHz typical (26..56 kHz), and the wakeup
+// timer from RTCCLK / 2
+#define SAMPLER_LSI_HZ 37000
+#define SAMPLER_RETRIES 3 // short naps when the conversion outlasts the first one
+
+#define SAMPLER_E_TIMEOUT INT8_C(-20)
+
+typedef struct {
+  int32_t Temperature; // 0.01 degC
+  uint32_t Pressure;   // Pa, 0 with the pressure oversampling off
+} SAMPLER_RESULT;
+
+// dev set up by bmp280_init(); writes conf with the sensor in sleep mode and
+// starts the RTC
+int8_t sampler_init(struct bmp280_dev *dev, const struct bmp280_config *conf);
+// conversion time of conf in us, datasheet maximum
+uint32_t sampler_meas_us(const struct bmp280_config *conf);
+// no SPI DMA may be in flight, STOP mode halts it
+int8_t sampler_read(struct bmp280_dev *dev, SAMPLER_RESULT *result);
+// from RTC_WKUP_IRQHandler()
+void sampler_rtc_irq(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
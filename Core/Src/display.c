@@ -7,4 +7,300 @@
  *  Implementing screen functions
  */
 
+#include <string.h>
+#include "display.h"
+#include "epdprof.h"
 
+static DISP_WIDGET disp_widgets[DISP_MAX_WIDGETS];
+static uint8_t disp_count;
+
+static uint16_t _disp_cellw(uint8_t size) {
+  return size == 8 ? 6 : size / 2;
+}
+
+static uint16_t _disp_cellh(uint8_t size) {
+  return (size / 8 + ((size % 8) ? 1 : 0)) * 8;
+}
+
+static DISP_WIDGET* _disp_widget(int8_t id) {
+  if (id < 0 || id >= disp_count) return NULL;
+  return &disp_widgets[id];
+}
+
+static int8_t _disp_add(uint8_t type, uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+    uint16_t color) {
+  DISP_WIDGET *wg;
+
+  if (disp_count >= DISP_MAX_WIDGETS || w == 0 || h == 0) return -1;
+  wg = &disp_widgets[disp_count];
+  memset(wg, 0, sizeof(*wg));
+  wg->Type = type;
+  wg->Flags = DISP_DIRTY;
+  wg->X = x;
+  wg->Y = y;
+  wg->W = w;
+  wg->H = h;
+  wg->Color = color;
+  return disp_count++;
+}
+
+void disp_init(void) {
+  disp_count = 0;
+}
+
+int8_t disp_add_text(uint16_t x, uint16_t y, uint8_t len, uint8_t size, uint16_t color) {
+  int8_t id;
+
+  if (len > DISP_TEXT_MAX) len = DISP_TEXT_MAX;
+  id = _disp_add(DISP_TEXT, x, y, len * _disp_cellw(size), _disp_cellh(size), color);
+  if (id >= 0) {
+    disp_widgets[id].Size = size;
+    disp_widgets[id].Len = len;
+    disp_widgets[id].DrawnX1 = disp_widgets[id].W; // box content unknown
+  }
+  return id;
+}
+
+int8_t disp_add_number(uint16_t x, uint16_t y, uint8_t len, uint8_t decimals, uint8_t size,
+    uint16_t color) {
+  int8_t id;
+
+  if (len > DISP_TEXT_MAX) len = DISP_TEXT_MAX;
+  id = _disp_add(DISP_NUMBER, x, y, len * _disp_cellw(size), _disp_cellh(size), color);
+  if (id >= 0) {
+    disp_widgets[id].Size = size;
+    disp_widgets[id].Len = len;
+    disp_widgets[id].Decimals = decimals;
+  }
+  return id;
+}
+
+int8_t disp_add_icon(uint16_t x, uint16_t y, const EPD_ASSET *icon) {
+  int8_t id = _disp_add(DISP_ICON, x, y, icon->Width, icon->Height, EPD_COLOR_BLACK);
+
+  if (id >= 0) disp_widgets[id].Data = icon;
+  return id;
+}
+
+int8_t disp_add_bar(uint16_t x, uint16_t y, uint16_t w, uint16_t h, int32_t min, int32_t max,
+    uint16_t color) {
+  int8_t id;
+
+  if (max <= min || w < 3 || h < 3) return -1;
+  id = _disp_add(DISP_BAR, x, y, w, h, color);
+  if (id >= 0) {
+    disp_widgets[id].Min = min;
+    disp_widgets[id].Max = max;
+    disp_widgets[id].Value = min;
+  }
+  return id;
+}
+
+int8_t disp_add_chart(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const int16_t *samples,
+    int32_t min, int32_t max, uint16_t color) {
+  int8_t id;
+
+  if (max <= min) return -1;
+  id = _disp_add(DISP_CHART, x, y, w, h, color);
+  if (id >= 0) {
+    disp_widgets[id].Data = samples;
+    disp_widgets[id].Min = min;
+    disp_widgets[id].Max = max;
+  }
+  return id;
+}
+
+void disp_invalidate(int8_t id) {
+  DISP_WIDGET *wg = _disp_widget(id);
+
+  if (wg != NULL) wg->Flags |= DISP_DIRTY;
+}
+
+void disp_invalidate_all(void) {
+  uint8_t i;
+
+  for (i = 0; i < disp_count; i++) {
+    disp_widgets[i].Flags |= DISP_DIRTY;
+  }
+}
+
+void disp_set_text(int8_t id, const char *text) {
+  DISP_WIDGET *wg = _disp_widget(id);
+
+  if (wg == NULL || wg->Type != DISP_TEXT) return;
+  if (strncmp(wg->Text, text, wg->Len) == 0) return;
+  strncpy(wg->Text, text, wg->Len);
+  wg->Text[wg->Len] = '\0';
+  wg->Flags |= DISP_DIRTY;
+}
+
+void disp_set_style(int8_t id, uint8_t style) {
+  DISP_WIDGET *wg = _disp_widget(id);
+
+  if (wg == NULL || wg->Type != DISP_TEXT || wg->Style == style) return;
+  wg->Style = style;
+  wg->Flags |= DISP_DIRTY;
+}
+
+void disp_set_number(int8_t id, int32_t value) {
+  DISP_WIDGET *wg = _disp_widget(id);
+
+  if (wg == NULL || wg->Type != DISP_NUMBER) return;
+  if (wg->Value == value) return;
+  wg->Value = value;
+  wg->Flags |= DISP_DIRTY;
+}
+
+// set once, before the first render: the box grows by the unit cells
+void disp_set_unit(int8_t id, const char *unit) {
+  DISP_WIDGET *wg = _disp_widget(id);
+  uint8_t n;
+
+  if (wg == NULL || wg->Type != DISP_NUMBER) return;
+  n = strlen(wg->Text);
+  strncpy(wg->Text, unit, DISP_TEXT_MAX);
+  wg->Text[DISP_TEXT_MAX] = '\0';
+  wg->W += (strlen(wg->Text) - n) * _disp_cellw(wg->Size);
+  wg->Flags |= DISP_DIRTY;
+}
+
+void disp_set_icon(int8_t id, const EPD_ASSET *icon) {
+  DISP_WIDGET *wg = _disp_widget(id);
+
+  if (wg == NULL || wg->Type != DISP_ICON || wg->Data == icon) return;
+  wg->Data = icon;
+  wg->Flags |= DISP_DIRTY;
+}
+
+void disp_set_bar(int8_t id, int32_t value) {
+  DISP_WIDGET *wg = _disp_widget(id);
+
+  if (wg == NULL || wg->Type != DISP_BAR) return;
+  if (value < wg->Min) value = wg->Min;
+  if (value > wg->Max) value = wg->Max;
+  if (wg->Value == value) return;
+  wg->Value = value;
+  wg->Flags |= DISP_DIRTY;
+}
+
+// the samples live in the caller's buffer, so a chart is always redrawn
+void disp_set_chart(int8_t id, uint16_t count) {
+  DISP_WIDGET *wg = _disp_widget(id);
+
+  if (wg == NULL || wg->Type != DISP_CHART) return;
+  wg->Count = count;
+  wg->Flags |= DISP_DIRTY;
+}
+
+static int32_t _disp_scale(int32_t v, int32_t min, int32_t max, int32_t range) {
+  if (v < min) v = min;
+  if (v > max) v = max;
+  return (v - min) * range / (max - min);
+}
+
+// fill the 0-based box x, y, w, h; drawRectangle() fills rows Ystart..Yend - 1
+static void _disp_fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+  if (w && h) epd_paint_drawRectangle(x + 1, y + 1, x + w, y + h + 1, color, 1);
+}
+
+// text is measured first and only the columns the old and the new text
+// cover are cleared, so the dirty rectangle is no wider than the change
+static void _disp_text(DISP_WIDGET *wg, uint16_t back) {
+  uint16_t w, h, x0, x1;
+  int32_t left = 0;
+
+  epd_paint_measureText(wg->Text, wg->W, wg->Size, wg->Style, &w, &h);
+  if (w > wg->W) w = wg->W;
+  if ((wg->Style & EPD_TEXT_ALIGN) == EPD_TEXT_CENTER) left = (wg->W - w) / 2;
+  else if ((wg->Style & EPD_TEXT_ALIGN) == EPD_TEXT_RIGHT) left = wg->W - w;
+  x0 = wg->DrawnX0 < wg->DrawnX1 && wg->DrawnX0 < left ? wg->DrawnX0 : left;
+  x1 = wg->DrawnX0 < wg->DrawnX1 && wg->DrawnX1 > left + w ? wg->DrawnX1 : left + w;
+  if (x0 < x1) _disp_fill(wg->X + x0, wg->Y, x1 - x0, wg->H, back);
+  epd_paint_drawText(wg->X, wg->Y, wg->W, wg->H, wg->Text, wg->Size, wg->Color, wg->Style);
+  wg->DrawnX0 = left;
+  wg->DrawnX1 = left + w;
+}
+
+static void _disp_draw(DISP_WIDGET *wg) {
+  const int16_t *s;
+  uint16_t i, x0, y0, x1, y1;
+  uint16_t back = EPD_COLOR_BACK(wg->Color);
+
+  // drawRectangle/drawLine take 1-based coordinates; icons cover their box
+  if (wg->Type != DISP_TEXT && (wg->Type != DISP_ICON || wg->Data == NULL)) {
+    _disp_fill(wg->X, wg->Y, wg->W, wg->H, back);
+  }
+  switch (wg->Type) {
+  case DISP_TEXT:
+    _disp_text(wg, back);
+    break;
+  case DISP_NUMBER:
+    epd_paint_showFixed(wg->X, wg->Y, wg->Value, wg->Decimals, wg->Len, wg->Text, wg->Size,
+        wg->Color);
+    break;
+  case DISP_ICON:
+    if (wg->Data != NULL) {
+      epd_paint_showAsset(wg->X, wg->Y, wg->Data);
+    }
+    break;
+  case DISP_BAR:
+    epd_paint_drawRectangle(wg->X + 1, wg->Y + 1, wg->X + wg->W, wg->Y + wg->H, wg->Color, 0);
+    x1 = _disp_scale(wg->Value, wg->Min, wg->Max, wg->W - 2);
+    if (wg->H > 2) _disp_fill(wg->X + 1, wg->Y + 1, x1, wg->H - 2, wg->Color);
+    break;
+  case DISP_CHART:
+    s = wg->Data;
+    if (s == NULL || wg->Count == 0) break;
+    x0 = wg->X + 1;
+    y0 = wg->Y + wg->H - _disp_scale(s[0], wg->Min, wg->Max, wg->H - 1);
+    for (i = 1; i < wg->Count; i++) {
+      x1 = wg->X + 1 + (uint32_t) i * (wg->W - 1) / (wg->Count - 1);
+      y1 = wg->Y + wg->H - _disp_scale(s[i], wg->Min, wg->Max, wg->H - 1);
+      epd_paint_drawLine(x0, y0, x1, y1, wg->Color);
+      x0 = x1;
+      y0 = y1;
+    }
+    if (wg->Count == 1) epd_paint_drawPoint(x0, y0, wg->Color);
+    break;
+  }
+}
+
+static uint8_t _disp_overlap(const DISP_WIDGET *a, const DISP_WIDGET *b) {
+  return a->X < b->X + b->W && b->X < a->X + a->W && a->Y < b->Y + b->H && b->Y < a->Y + a->H;
+}
+
+// redraw the invalidated widgets into EPD_Paint; the paint layer records
+// the touched area as the dirty rectangle. Returns 1 if anything was drawn
+uint8_t disp_render(void) {
+  uint8_t i, j, drawn = 0, spread;
+  EPD_PROF_START(t);
+
+  // clearing a box wipes whatever overlaps it, and redrawing that widget
+  // clears its own box in turn: repeat until no more widgets join
+  do {
+    spread = 0;
+    for (i = 0; i < disp_count; i++) {
+      if (!(disp_widgets[i].Flags & DISP_DIRTY)) continue;
+      for (j = 0; j < disp_count; j++) {
+        if (disp_widgets[j].Flags & DISP_DIRTY) continue;
+        if (_disp_overlap(&disp_widgets[i], &disp_widgets[j])) {
+          disp_widgets[j].Flags |= DISP_DIRTY;
+          spread = 1;
+        }
+      }
+    }
+  } while (spread);
+  for (i = 0; i < disp_count; i++) {
+    if (!(disp_widgets[i].Flags & DISP_DIRTY)) continue;
+    _disp_draw(&disp_widgets[i]);
+    disp_widgets[i].Flags &= ~DISP_DIRTY;
+    drawn = 1;
+  }
+  EPD_PROF_STOP(EPD_PROF_RENDER, t, 0);
+  return drawn;
+}
+
+// render and send only the changed area to the panel
+void disp_refresh(void) {
+  if (disp_render()) epd_displayBW_async(1);
+}
@@ -7,8 +7,9 @@
  - blog: www.weact-tc.cn
  ---------------------------------------*/
 
+#include <string.h>
 #include "epaper.h"
-#include "epdfont.h"
+#include "epdprof.h"
 
 //#include "systick.h"
 
@@ -25,6 +26,35 @@ EPD_PAINT EPD_Paint;
 EPD_PINS epd_pins;
 
 static uint8_t _hibernating = 1;
+static uint8_t _epd_configured = 0; // registers set up by epd_init()
+static uint8_t _epd_voltages = 0;   // gray LUT voltages set, cleared by a reset
+static uint8_t _epd_ram_frame = 0;  // both RAMs hold the frame on the panel
+
+// SSD1680 hardware reset: RES# low for 10 ms, then 1 ms before BUSY is
+// valid; epd_init() waits for BUSY instead of a fixed delay
+#define EPD_RESET_LOW_MS 10
+#define EPD_RESET_HIGH_MS 1
+
+static volatile uint8_t _epd_updating = 0;
+static void (*volatile _epd_update_done)(void) = NULL;
+
+// window of a partial update whose old image RAM (0x26) is written once the
+// waveform ends; Image belongs to the driver until then
+typedef struct {
+  uint8_t *Image;
+  uint16_t Xstart, Ystart, Xend, Yend;
+  uint8_t Dirty; // the dirty area of EPD_Paint, nothing outside it changed
+} EPD_OLDRAM;
+
+static EPD_OLDRAM _epd_old;
+static uint8_t *_epd_back = NULL; // second frame buffer, see epd_paint_doublebuffer()
+
+static void _epd_partial_old(const EPD_OLDRAM *w);
+
+// Fletcher-16 of every buffer row last written to the BW RAM (0x24); a row
+// is only trusted while its valid bit is set
+static uint16_t _epd_rowsum[EPD_H];
+static uint8_t _epd_rowvalid[(EPD_H + 7) / 8];
 
 static const unsigned char ut_partial[] = { 0x0, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
     0x0, 0x80, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40, 0x40, 0x0, 0x0, 0x0,
@@ -36,6 +66,89 @@ static const unsigned char ut_partial[] = { 0x0, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
     0x0, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x0, 0x0, 0x0, };
 
+// 4-gray waveform, VS levels per RAM bit pair (0x24, 0x26): 00 black,
+// 01 dark gray, 10 light gray, 11 white; the last 6 bytes are EOPT (0x3F),
+// gate (0x03), source (0x04) and VCOM (0x2C) voltages
+static const unsigned char ut_gray[] = { 0x00, 0x60, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x60, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x60,
+    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x60, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x05, 0x14, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x02, 0x00, 0x05, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x22, 0x22, 0x22, 0x23, 0x32, 0x00, 0x00, 0x00, 0x22,
+    0x17, 0x41, 0xAE, 0x32, 0x28, };
+
+#define EPD_LUT_SIZE sizeof(ut_partial)
+
+// partial waveforms by temperature, sorted by TempMin; the full update
+// always takes the OTP waveform picked by the controller's own sensor
+typedef struct {
+  int8_t TempMin; // degC
+  const unsigned char *Data;
+} EPD_LUT;
+
+static const EPD_LUT _epd_partial_luts[] = {
+  { -128, ut_partial },
+};
+
+// command sequences: {command, argument count | EPD_SEQ_WAIT, arguments}
+// one after the other
+#define EPD_SEQ_WAIT 0x80 // wait for BUSY low after the command
+
+static const uint8_t _epd_swreset_seq[] = {
+  0x12, 0 | EPD_SEQ_WAIT, // SWRESET
+};
+
+// buffer row 0 is the last gate, the Y counter runs down (entry mode 0x01)
+#define EPD_RAM_XEND (EPD_RAM_X0 + EPD_W_BUFF_SIZE - 1)
+#define EPD_RAM_YEND (EPD_RAM_Y0 + EPD_H - 1)
+#define EPD_LE16(v) ((v) & 0xFF), ((v) >> 8 & 0x01)
+
+static const uint8_t _epd_init_seq[] = {
+  0x01, 3, EPD_LE16(EPD_RAM_YEND), 0x01,                // Driver output control: gates
+  0x11, 1, 0x01,                                        // data entry mode
+  0x44, 2, EPD_RAM_X0, EPD_RAM_XEND,                    // Ram-X start/end, bytes
+  0x45, 4, EPD_LE16(EPD_RAM_YEND), EPD_LE16(EPD_RAM_Y0), // Ram-Y start/end
+  0x3C, 1, 0x05,                                        // BorderWavefrom
+  0x21, 2, 0x00, 0x80,                                  // Display update control
+  0x18, 1, 0x80,                                        // Read built-in temperature sensor
+  0x4E, 1, EPD_RAM_X0,                                  // RAM x address count
+  0x4F, 2 | EPD_SEQ_WAIT, EPD_LE16(EPD_RAM_YEND),       // RAM y address count
+};
+
+// what differs between panels besides the geometry of epaper.h, which is
+// fixed at compile time so the buffers and transfer loops fold to constants
+typedef struct {
+  const uint8_t *Init; // run by epd_init() after a reset
+  uint16_t InitLen;
+  const EPD_LUT *Luts; // partial waveforms
+  uint8_t LutCount;
+  uint16_t FullMs;     // typical waveform times; an update is given up
+  uint16_t PartialMs;  // after twice as long
+} EPD_PANEL;
+
+// the panels share the controller setup and differ in the partial waveform
+#ifdef EPD_29
+#define EPD_PANEL_PARTIAL_MS 400
+#endif
+#ifdef EPD_213
+#define EPD_PANEL_PARTIAL_MS 300
+#endif
+
+static const EPD_PANEL _epd_panel = {
+  _epd_init_seq, sizeof(_epd_init_seq),
+  _epd_partial_luts, sizeof(_epd_partial_luts) / sizeof(_epd_partial_luts[0]),
+  2000, EPD_PANEL_PARTIAL_MS,
+};
+
+static uint16_t _epd_update_timeout; // ms, set when an update starts
+
+static const unsigned char *_epd_lut_loaded = NULL; // NULL: OTP or unknown
+static int8_t _epd_temperature = 25;
+
 void epd_delay(uint16_t ms) {
   HAL_Delay(ms);
 }
@@ -87,9 +200,10 @@ void epd_io_init(void) {
   GPIO_InitStructure.Speed = GPIO_SPEED_HIGH;
   HAL_GPIO_Init(epd_pins.res_port, &GPIO_InitStructure);
 
-  /* configure the epaper module busy pin */
-  GPIO_InitStructure.Mode = GPIO_MODE_INPUT;
-  GPIO_InitStructure.Pull = GPIO_PULLUP;
+  /* configure the epaper module busy pin, falling edge ends a refresh; the
+   controller drives it, a pull-up would only draw current while it idles low */
+  GPIO_InitStructure.Mode = GPIO_MODE_IT_FALLING;
+  GPIO_InitStructure.Pull = GPIO_NOPULL;
   GPIO_InitStructure.Pin = epd_pins.busy_pin;
   HAL_GPIO_Init(epd_pins.busy_port, &GPIO_InitStructure);
 
@@ -130,7 +244,11 @@ void epd_io_init(void) {
 //  SPI_Cmd(SPI2, ENABLE);
 }
 
+// BUSY high makes the controller ignore the interface, so every command
+// first waits for a running update and the old image RAM that follows it
 void epd_write_reg(uint8_t reg) {
+  if (_epd_updating || _epd_old.Image != NULL) epd_wait_update();
+  EPD_PROF_START(t);
   epd_dc_reset();
   epd_cs_reset();
 
@@ -147,48 +265,27 @@ void epd_write_reg(uint8_t reg) {
 
   epd_cs_set();
   epd_dc_set();
+  EPD_PROF_STOP(EPD_PROF_SPI, t, 1);
 }
 
-void epd_write_data(uint8_t data) {
+// reg and its n argument bytes in one CS low transaction, the arguments in
+// one transfer
+void epd_write_cmd(uint8_t reg, const uint8_t *data, uint16_t n) {
+  if (_epd_updating || _epd_old.Image != NULL) epd_wait_update();
+  EPD_PROF_START(t);
+  epd_dc_reset();
   epd_cs_reset();
-
-  HAL_SPI_Transmit(epd_pins.hspi, &data, 1, 100);
-  uint8_t timeout = 100;
-  while (HAL_SPI_GetState(epd_pins.hspi) != HAL_SPI_STATE_READY) {
-    timeout--;
-    if (!timeout) break;
-    HAL_Delay(1);
-  }
-  //SPI_I2S_SendData(SPI2, data);
-  //while (SPI_I2S_GetFlagStatus(SPI2, SPI_I2S_FLAG_BSY) != RESET);
-
+  HAL_SPI_Transmit(epd_pins.hspi, &reg, 1, 100);
+  epd_dc_set();
+  // a blocking transmit returns once the SPI is no longer busy, CS can rise
+  if (n) HAL_SPI_Transmit(epd_pins.hspi, (uint8_t*) data, n, 100);
   epd_cs_set();
-}
-
-void _epd_write_data(uint8_t data) {
-  uint8_t timeout = 100;
-  while (HAL_SPI_GetState(epd_pins.hspi) != HAL_SPI_STATE_READY) {
-    timeout--;
-    if (!timeout) break;
-    HAL_Delay(1);
-  }
-  HAL_SPI_Transmit(epd_pins.hspi, &data, 1, 100);
-  //while (SPI_I2S_GetFlagStatus(SPI2, SPI_I2S_FLAG_TXE) == RESET);
-  //SPI_I2S_SendData(SPI2, data);
-}
-
-void _epd_write_data_over() {
-  uint16_t timeout = 1000;
-  while (HAL_SPI_GetState(epd_pins.hspi) != HAL_SPI_STATE_READY) {
-    timeout--;
-    if (!timeout) break;
-    HAL_Delay(1);
-  }
-  //while (SPI_I2S_GetFlagStatus(SPI2, SPI_I2S_FLAG_BSY) != RESET);
+  EPD_PROF_STOP(EPD_PROF_SPI, t, 1 + n);
 }
 
 uint8_t epd_wait_busy() {
   uint32_t timeout = 0;
+  EPD_PROF_START(t);
   while (epd_is_busy()) {
     timeout++;
     if (timeout > 4000) {
@@ -196,137 +293,372 @@ uint8_t epd_wait_busy() {
     }
     epd_delay(1);
   }
+  EPD_PROF_STOP(EPD_PROF_WAIT, t, 0);
   return 0;
 }
 
+// every register back at its default, the RAM is kept
 void epd_reset(void) {
+  EPD_PROF_START(t);
   epd_res_reset();
-  epd_delay(50);
+  epd_delay(EPD_RESET_LOW_MS);
   epd_res_set();
-  epd_delay(50);
+  epd_delay(EPD_RESET_HIGH_MS);
+  EPD_PROF_STOP(EPD_PROF_WAIT, t, 0);
   _hibernating = 0;
+  _epd_configured = 0;
+  _epd_voltages = 0;
+  _epd_lut_loaded = NULL;
 }
 
-uint8_t epd_init(void) {
-  if (_hibernating) epd_reset();
+static uint8_t _epd_run(const uint8_t *seq, uint16_t len) {
+  const uint8_t *end = seq + len;
+  uint8_t n;
 
-  if (epd_wait_busy()) return 1;
+  while (seq < end) {
+    n = seq[1] & ~EPD_SEQ_WAIT;
+    epd_write_cmd(seq[0], seq + 2, n);
+    if ((seq[1] & EPD_SEQ_WAIT) && epd_wait_busy()) return 1;
+    seq += 2 + n;
+  }
+  return 0;
+}
 
-  epd_write_reg(0x12); // SWRESET
+// a no-op while the controller is awake and still configured; waking from
+// deep sleep takes the hardware reset the controller needs anyway, whose
+// register defaults make a software reset redundant
+uint8_t epd_init(void) {
+  if (_hibernating) epd_reset();
+  if (_epd_configured) return 0;
 
   if (epd_wait_busy()) return 1;
+  if (_epd_voltages && _epd_run(_epd_swreset_seq, sizeof(_epd_swreset_seq))) return 1;
+  _epd_voltages = 0;
+  if (_epd_run(_epd_panel.Init, _epd_panel.InitLen)) return 1;
 
-  epd_write_reg(0x01); // Driver output control
-  epd_write_data(0x27);
-  epd_write_data(0x01);
-  epd_write_data(0x01);
-
-  epd_write_reg(0x11); // data entry mode
-  epd_write_data(0x01);
+  _epd_configured = 1;
+  _epd_lut_loaded = NULL;
+  return 0;
+}
 
-  epd_write_reg(0x44); // set Ram-X address start/end position
-  epd_write_data(0x00);
-  epd_write_data(0x0F); // 0x0F-->(15+1)*8=128
+static const unsigned char* _epd_partial_lut(void) {
+  uint8_t i = 0;
 
-  epd_write_reg(0x45); // set Ram-Y address start/end position
-  epd_write_data(0x27); // 0x127-->(295+1)=296
-  epd_write_data(0x01);
-  epd_write_data(0x00);
-  epd_write_data(0x00);
+  while (i + 1 < _epd_panel.LutCount && _epd_panel.Luts[i + 1].TempMin <= _epd_temperature) {
+    i++;
+  }
+  return _epd_panel.Luts[i].Data;
+}
 
-  epd_write_reg(0x3C); // BorderWavefrom
-  epd_write_data(0x05);
+// upload a waveform with 0x32 unless the controller already holds it
+static void _epd_lut_load(const unsigned char *lut) {
+  if (lut == _epd_lut_loaded) return;
 
-  epd_write_reg(0x21); //  Display update control
-  epd_write_data(0x00);
-  epd_write_data(0x80);
+  epd_write_cmd(0x32, lut, EPD_LUT_SIZE);
+  _epd_lut_loaded = lut;
+}
 
-  epd_write_reg(0x18); // Read built-in temperature sensor
-  epd_write_data(0x80);
+// the gray waveform also sets its own voltages, which the partial LUTs do
+// not; the next epd_init() starts over from a software reset unless a
+// hardware reset comes first
+static void _epd_lut_load_gray(void) {
+  const unsigned char *v = ut_gray + EPD_LUT_SIZE;
+  const uint8_t seq[] = {
+    0x3F, 1, v[0],             // EOPT
+    0x03, 1, v[1],             // VGH
+    0x04, 3, v[2], v[3], v[4], // VSH1, VSH2, VSL
+    0x2C, 1, v[5],             // VCOM
+  };
+
+  if (_epd_lut_loaded == ut_gray) return;
+
+  _epd_lut_load(ut_gray);
+  _epd_run(seq, sizeof(seq));
+  _epd_configured = 0;
+  _epd_voltages = 1;
+}
 
-  epd_write_reg(0x4E); // set RAM x address count to 0;
-  epd_write_data(0x00);
-  epd_write_reg(0x4F); // set RAM y address count to 0x127;
-  epd_write_data(0x27);
-  epd_write_data(0x01);
+uint8_t epd_init_partial(void) {
+  if (epd_init()) return 1;
 
-  if (epd_wait_busy()) return 1;
+  _epd_lut_load(_epd_partial_lut());
 
   return 0;
 }
 
-uint8_t epd_init_partial(void) {
-  if (epd_init()) return 1;
+// ambient temperature for picking the partial waveform, e.g. from the BMP280
+void epd_set_temperature(int8_t temp) {
+  _epd_temperature = temp;
+}
 
-  epd_write_reg(0x32);
-  epd_cs_reset();
-  for (int j = 0; j < sizeof(ut_partial); j++) {
-    _epd_write_data(ut_partial[j]);
-  }
-  _epd_write_data_over();
-  epd_cs_set();
+uint8_t epd_is_hibernating(void) {
+  return _hibernating;
+}
 
-  return 0;
+// 1 while the old image RAM (0x26) matches the panel, which partial
+// updates rely on; lost with deep sleep mode 2, red and gray frames
+uint8_t epd_ram_retained(void) {
+  return _epd_ram_frame;
 }
 
 void epd_enter_deepsleepmode(uint8_t mode) {
-  epd_write_reg(0x10);
-  epd_write_data(mode);
+  epd_wait_update();
+  epd_write_cmd(0x10, &mode, 1);
   _hibernating = 1;
+  _epd_configured = 0;
+  _epd_lut_loaded = NULL;
+  // only mode 1 keeps the RAM content
+  if (mode != EPD_DEEPSLEEP_MODE1) {
+    memset(_epd_rowvalid, 0, sizeof(_epd_rowvalid));
+    _epd_ram_frame = 0;
+  }
 }
 
+static const uint8_t _epd_tempsensor_seq[] = {
+  0x18, 1, 0x80,       // internal sensor
+  0x1A, 2, 0x7F, 0xF0, // temperature register
+};
+
 void epd_init_internalTempSensor(void) {
-  epd_write_reg(0x18);
-  epd_write_data(0x80);
+  _epd_run(_epd_tempsensor_seq, sizeof(_epd_tempsensor_seq));
+}
 
-  epd_write_reg(0x1A);
-  epd_write_data(0x7F);
-  epd_write_data(0xF0);
+// called from HAL_GPIO_EXTI_Callback() on the BUSY falling edge
+void epd_busy_irq(void) {
+  void (*done)(void) = _epd_update_done;
+
+  if (!_epd_updating) return;
+  epd_prof_done();
+  _epd_updating = 0;
+  _epd_update_done = NULL;
+  if (done) done();
 }
 
-void epd_update(void) {
-  epd_write_reg(0x22); // Display Update Control
-  epd_write_data(0xF7);
-  epd_write_reg(0x20); // Activate Display Update Sequence
+static void _epd_update_start(uint8_t mode, void (*done)(void)) {
+  const uint8_t seq[] = {
+    0x22, 1, mode, // Display Update Control
+    0x20, 0,       // Activate Display Update Sequence
+  };
+
+  epd_wait_update();
+
+  // 0xF7 loads the OTP waveform over whatever 0x32 put there, 0xCC and
+  // 0xC7 run the loaded one
+  if (mode == 0xCC) _epd_lut_load(_epd_partial_lut());
+  else if (mode == 0xC7) _epd_lut_load_gray();
+  else _epd_lut_loaded = NULL;
 
-  epd_wait_busy();
+  _epd_run(seq, sizeof(seq));
+
+  _epd_update_timeout = 2 * (mode == 0xCC ? _epd_panel.PartialMs : _epd_panel.FullMs);
+  epd_prof_update(mode);
+  // BUSY only falls once the waveform is over
+  _epd_update_done = done;
+  _epd_updating = 1;
 }
 
-void epd_update_partial(void) {
-  epd_write_reg(0x22); // Display Update Control
-  epd_write_data(0xCC);
-  epd_write_reg(0x20); // Activate Display Update Sequence
+uint8_t epd_is_updating(void) {
+  return _epd_updating;
+}
+
+uint8_t epd_wait_update(void) {
+  uint32_t tickstart = HAL_GetTick();
+  uint8_t timeout = 0;
+  EPD_OLDRAM w;
+  EPD_PROF_START(t);
+
+  while (_epd_updating) {
+    if (HAL_GetTick() - tickstart > _epd_update_timeout) {
+      _epd_updating = 0;
+      _epd_update_done = NULL;
+      timeout = 1;
+      break;
+    }
+    __WFI();
+  }
+  EPD_PROF_STOP(EPD_PROF_UPDATE, t, 0);
+  if (_epd_old.Image != NULL) {
+    w = _epd_old;
+    _epd_old.Image = NULL;
+    _epd_partial_old(&w);
+  }
+  return timeout;
+}
+
+void epd_update_async(void (*done)(void)) {
+  _epd_update_start(0xF7, done);
+}
+
+void epd_update_partial_async(void (*done)(void)) {
+  _epd_update_start(0xCC, done);
+}
 
-  epd_wait_busy();
+void epd_update(void) {
+  _epd_update_start(0xF7, NULL);
+  epd_wait_update();
+}
+
+void epd_update_partial(void) {
+  _epd_update_start(0xCC, NULL);
+  epd_wait_update();
 }
 
 void epd_setpos(uint16_t x, uint16_t y) {
-  uint8_t _x;
-  uint16_t _y;
+  uint16_t _y = EPD_RAM_YEND - y;
+  const uint8_t seq[] = {
+    0x4E, 1, EPD_RAM_X0 + x / 8, // RAM x address count
+    0x4F, 2, EPD_LE16(_y),       // RAM y address count
+  };
+
+  _epd_run(seq, sizeof(seq));
+}
+
+// RAM window in pixel columns / buffer rows, same coordinates as epd_setpos()
+void epd_setwindow(uint16_t xstart, uint16_t ystart, uint16_t xend, uint16_t yend) {
+  uint16_t _ys = EPD_RAM_YEND - ystart, _ye = EPD_RAM_YEND - yend;
+  const uint8_t seq[] = {
+    0x44, 2, EPD_RAM_X0 + xstart / 8, EPD_RAM_X0 + xend / 8, // Ram-X address start/end position
+    0x45, 4, EPD_LE16(_ys), EPD_LE16(_ye),
+  };
+
+  _epd_run(seq, sizeof(seq));
+
+  epd_setpos(xstart, ystart);
+}
+
+// streaming engine: whole planes go out in one DMA transaction when the
+// SPI handle has a TX DMA channel linked, otherwise in one blocking call.
+// Transformed data (inverted plane, gathered window) is produced chunk by
+// chunk into two small bounce buffers, filling one while the other is sent.
+#define EPD_STREAM_CHUNK 64
+#define EPD_STREAM_TIMEOUT 100
+
+static uint8_t _epd_stream_buf[2][EPD_STREAM_CHUNK];
+
+static void _epd_stream_wait(void) {
+  uint32_t tickstart = HAL_GetTick();
+  while (HAL_SPI_GetState(epd_pins.hspi) != HAL_SPI_STATE_READY) {
+    if (HAL_GetTick() - tickstart > EPD_STREAM_TIMEOUT) break;
+    __WFI();
+  }
+}
 
-  _x = x / 8;
+static void _epd_stream_start(const uint8_t *data, uint16_t length) {
+  if (epd_pins.hspi->hdmatx != NULL) {
+    HAL_SPI_Transmit_DMA(epd_pins.hspi, (uint8_t*) data, length);
+  }
+  else {
+    HAL_SPI_Transmit(epd_pins.hspi, (uint8_t*) data, length, EPD_STREAM_TIMEOUT);
+  }
+}
+
+static void _epd_stream(const uint8_t *data, uint32_t length) {
+  uint32_t i;
+  uint16_t n;
+  EPD_PROF_START(t);
+
+  for (i = 0; i < length; i += n) {
+    n = length - i > 0xFFFF ? 0xFFFF : length - i;
+    _epd_stream_wait();
+    _epd_stream_start(data + i, n);
+  }
+  _epd_stream_wait();
+  EPD_PROF_STOP(EPD_PROF_SPI, t, length);
+}
 
-  _y = 295 - y;
+static void _epd_stream_fill(void (*fill)(uint8_t*, uint16_t, void*), void *ctx,
+    uint32_t length) {
+  uint32_t i;
+  uint8_t k = 0;
+  uint16_t n;
+  EPD_PROF_START(t);
+
+  for (i = 0; i < length; i += n) {
+    n = length - i > EPD_STREAM_CHUNK ? EPD_STREAM_CHUNK : length - i;
+    fill(_epd_stream_buf[k], n, ctx); // overlaps the transfer of the other buffer
+    _epd_stream_wait();
+    _epd_stream_start(_epd_stream_buf[k], n);
+    k ^= 1;
+  }
+  _epd_stream_wait();
+  EPD_PROF_STOP(EPD_PROF_SPI, t, length);
+}
 
-  epd_write_reg(0x4E); // set RAM x address count to 0;
-  epd_write_data(_x);
-  epd_write_reg(0x4F); // set RAM y address count to 0x127;
-  epd_write_data(_y & 0xff);
-  epd_write_data(_y >> 8 & 0x01);
+static void _epd_fill_invert(uint8_t *buf, uint16_t n, void *ctx) {
+  const uint8_t **src = ctx;
+  while (n--) {
+    *buf++ = ~*(*src)++;
+  }
 }
 
 void epd_writedata(uint8_t *Image1, uint32_t length) {
   epd_cs_reset();
-  for (uint32_t j = 0; j < length; j++) {
-    _epd_write_data(Image1[j]);
-  }
-  _epd_write_data_over();
+  _epd_stream(Image1, length);
+  epd_cs_set();
+}
+
+void epd_writedata_invert(uint8_t *Image1, uint32_t length) {
+  const uint8_t *src = Image1;
+
+  epd_cs_reset();
+  _epd_stream_fill(_epd_fill_invert, &src, length);
   epd_cs_set();
 }
 
+static uint16_t _epd_fletcher16(const uint8_t *data, uint16_t n) {
+  uint32_t a = 0, b = 0;
+
+  while (n--) {
+    a += *data++;
+    b += a;
+  }
+  return (b % 255) << 8 | (a % 255);
+}
+
+// 1 if any of rows y..y+n-1 of Image (n rows from Rows) differ from the
+// panel RAM or are unknown
+static uint8_t _epd_rows_changed(const uint8_t *Rows, uint16_t y, uint16_t n) {
+  for (; n; n--, y++, Rows += EPD_W_BUFF_SIZE) {
+    if (!(_epd_rowvalid[y / 8] & (1 << (y % 8)))) return 1;
+    if (_epd_rowsum[y] != _epd_fletcher16(Rows, EPD_W_BUFF_SIZE)) return 1;
+  }
+  return 0;
+}
+
+static void _epd_rows_store(const uint8_t *Rows, uint16_t y, uint16_t n) {
+  for (; n; n--, y++, Rows += EPD_W_BUFF_SIZE) {
+    _epd_rowsum[y] = _epd_fletcher16(Rows, EPD_W_BUFF_SIZE);
+    _epd_rowvalid[y / 8] |= 1 << (y % 8);
+  }
+}
+
+static void _epd_rows_invalidate(uint16_t y, uint16_t n) {
+  for (; n; n--, y++) {
+    _epd_rowvalid[y / 8] &= ~(1 << (y % 8));
+  }
+}
+
+uint8_t epd_row_changed(const uint8_t *Image, uint16_t y) {
+  if (_epd_old.Image != NULL) epd_wait_update(); // its rows are not stored yet
+  return _epd_rows_changed(Image + (uint32_t) y * EPD_W_BUFF_SIZE, y, 1);
+}
+
+// narrow *ystart..*yend to the rows that changed, 0 if none did
+static uint8_t _epd_diffrows(const uint8_t *Image, uint16_t *ystart, uint16_t *yend) {
+  uint16_t y0 = *ystart, y1 = *yend;
+
+  if (_epd_old.Image != NULL) epd_wait_update(); // its rows are not stored yet
+
+  while (y0 <= y1 && !_epd_rows_changed(Image + (uint32_t) y0 * EPD_W_BUFF_SIZE, y0, 1)) y0++;
+  if (y0 > y1) return 0;
+  while (!_epd_rows_changed(Image + (uint32_t) y1 * EPD_W_BUFF_SIZE, y1, 1)) y1--;
+  *ystart = y0;
+  *yend = y1;
+  return 1;
+}
+
 void epd_display(uint8_t *Image1, uint8_t *Image2) {
-  uint32_t Width, Height, i, j;
-  uint32_t k = 0;
+  uint32_t Width, Height;
   Width = EPD_H;
   Height = EPD_W_BUFF_SIZE;
 
@@ -338,21 +670,16 @@ void epd_display(uint8_t *Image1, uint8_t *Image2) {
   epd_setpos(0, 0);
 
   epd_write_reg(0x26);
-  k = 0;
-  epd_cs_reset();
-  for (j = 0; j < Height; j++) {
-    for (i = 0; i < Width; i++) {
-      _epd_write_data(~Image2[k]);
-      k++;
-    }
-  }
-  _epd_write_data_over();
-  epd_cs_set();
+  epd_writedata_invert(Image2, Width * Height);
 
   epd_update();
+
+  _epd_rows_store(Image1, 0, EPD_H);
+  _epd_ram_frame = 0;
 }
 
-void epd_displayBW(uint8_t *Image) {
+// the whole frame to both RAMs, ahead of a full update
+static void _epd_writeframe(uint8_t *Image) {
   uint32_t Width, Height;
 
   Width = EPD_H;
@@ -365,25 +692,224 @@ void epd_displayBW(uint8_t *Image) {
   epd_setpos(0, 0);
   epd_write_reg(0x24);
   epd_writedata(Image, Width * Height);
+}
 
+void epd_displayBW(uint8_t *Image) {
+  _epd_writeframe(Image);
   epd_update();
+
+  _epd_rows_store(Image, 0, EPD_H);
+  _epd_ram_frame = 1;
+  if (Image == EPD_Paint.Image) epd_paint_cleardirty();
 }
 
+// only the rows that differ from the last frame are sent; an identical
+// frame costs neither SPI traffic nor a waveform, except for rows an
+// epd_displayBW_partial_area() window sent only in part
 void epd_displayBW_partial(uint8_t *Image) {
-  uint32_t Width, Height;
+  epd_displayBW_partial_area(Image, 0, 0, EPD_W - 1, EPD_H - 1);
 
-  Width = EPD_H;
-  Height = EPD_W_BUFF_SIZE;
+  if (Image == EPD_Paint.Image) epd_paint_cleardirty();
+}
 
-  epd_setpos(0, 0);
+typedef struct {
+  const uint8_t *row;
+  uint16_t pos;
+  uint16_t width;
+} EPD_WINDOW_CURSOR;
+
+static void _epd_fill_window(uint8_t *buf, uint16_t n, void *ctx) {
+  EPD_WINDOW_CURSOR *c = ctx;
+  while (n--) {
+    *buf++ = c->row[c->pos++];
+    if (c->pos == c->width) {
+      c->pos = 0;
+      c->row += EPD_W_BUFF_SIZE;
+    }
+  }
+}
+
+// stream rows ystart..yend, byte columns xstart/8..xend/8 of a full frame
+static void _epd_writewindow(uint8_t *Image, uint16_t xstart, uint16_t ystart, uint16_t xend,
+    uint16_t yend) {
+  EPD_WINDOW_CURSOR c;
+  uint32_t rows = yend - ystart + 1;
+
+  c.row = Image + (uint32_t) ystart * EPD_W_BUFF_SIZE + xstart / 8;
+  c.pos = 0;
+  c.width = xend / 8 - xstart / 8 + 1;
+
+  epd_cs_reset();
+  if (c.width == EPD_W_BUFF_SIZE) _epd_stream(c.row, rows * EPD_W_BUFF_SIZE);
+  else _epd_stream_fill(_epd_fill_window, &c, rows * c.width);
+  epd_cs_set();
+}
+
+// first half of a partial update: the rows of the area that changed go to
+// the new image RAM (0x24), w is the window left for _epd_partial_old()
+static uint8_t _epd_partial_new(EPD_OLDRAM *w, uint8_t *Image, uint16_t Xstart, uint16_t Ystart,
+    uint16_t Xend, uint16_t Yend, uint8_t Dirty) {
+  if (Xend >= EPD_W) Xend = EPD_W - 1;
+  if (Yend >= EPD_H) Yend = EPD_H - 1;
+  if (Xstart > Xend || Ystart > Yend) return 0;
+  if (!_epd_diffrows(Image, &Ystart, &Yend)) return 0;
+
+  epd_setwindow(Xstart, Ystart, Xend, Yend);
   epd_write_reg(0x24);
-  epd_writedata(Image, Width * Height);
+  _epd_writewindow(Image, Xstart, Ystart, Xend, Yend);
+
+  w->Image = Image;
+  w->Xstart = Xstart;
+  w->Ystart = Ystart;
+  w->Xend = Xend;
+  w->Yend = Yend;
+  w->Dirty = Dirty;
+  return 1;
+}
 
-  epd_update_partial();
+// second half, after the waveform: the same window, still set, to the old
+// image RAM
+static void _epd_partial_old(const EPD_OLDRAM *w) {
+  uint8_t full = w->Xstart == 0 && w->Xend / 8 == EPD_W_BUFF_SIZE - 1;
+  uint16_t y;
 
-  epd_setpos(0, 0);
+  epd_setpos(w->Xstart, w->Ystart);
   epd_write_reg(0x26);
-  epd_writedata(Image, Width * Height);
+  _epd_writewindow(w->Image, w->Xstart, w->Ystart, w->Xend, w->Yend);
+
+  // a row sent in part matches the image when the RAM held the rest of it
+  // already: its checksum was valid and only the dirty area changed since
+  for (y = w->Ystart; y <= w->Yend; y++) {
+    if (full || (w->Dirty && (_epd_rowvalid[y / 8] & (1 << (y % 8))))) {
+      _epd_rows_store(w->Image + (uint32_t) y * EPD_W_BUFF_SIZE, y, 1);
+    }
+    else {
+      _epd_rows_invalidate(y, 1);
+    }
+  }
+
+  // full screen window is what the other display paths expect
+  epd_setwindow(0, 0, EPD_W - 1, EPD_H - 1);
+}
+
+static uint8_t _epd_partial_area(uint8_t *Image, uint16_t Xstart, uint16_t Ystart, uint16_t Xend,
+    uint16_t Yend, uint8_t Dirty) {
+  EPD_OLDRAM w;
+
+  if (!_epd_partial_new(&w, Image, Xstart, Ystart, Xend, Yend, Dirty)) return 0;
+  epd_update_partial();
+  _epd_partial_old(&w);
+  return 1;
+}
+
+uint8_t epd_displayBW_partial_area(uint8_t *Image, uint16_t Xstart, uint16_t Ystart,
+    uint16_t Xend, uint16_t Yend) {
+  return _epd_partial_area(Image, Xstart, Ystart, Xend, Yend, 0);
+}
+
+uint8_t epd_displayBW_partial_dirty(void) {
+  uint8_t refreshed;
+
+  if (!epd_paint_isdirty()) return 0;
+
+  refreshed = _epd_partial_area(EPD_Paint.Image, EPD_Paint.DirtyXStart, EPD_Paint.DirtyYStart,
+      EPD_Paint.DirtyXEnd, EPD_Paint.DirtyYEnd, 1);
+  epd_paint_cleardirty();
+  return refreshed;
+}
+
+// EPD_Paint.Image as a full or a partial (dirty area) update that runs on
+// while this returns; a partial one keeps the image until its old image RAM
+// is written. With a second buffer the frame is copied over and drawing
+// goes on there at once, else this waits for the update
+uint8_t epd_displayBW_async(uint8_t partial) {
+  uint8_t *image = EPD_Paint.Image;
+  EPD_OLDRAM w;
+
+  if (partial) {
+    if (!epd_paint_isdirty()) return 0;
+    if (!_epd_partial_new(&w, image, EPD_Paint.DirtyXStart, EPD_Paint.DirtyYStart,
+        EPD_Paint.DirtyXEnd, EPD_Paint.DirtyYEnd, 1)) {
+      epd_paint_cleardirty();
+      return 0;
+    }
+    _epd_update_start(0xCC, NULL);
+    _epd_old = w;
+  }
+  else {
+    _epd_writeframe(image);
+    _epd_update_start(0xF7, NULL);
+    _epd_rows_store(image, 0, EPD_H);
+    _epd_ram_frame = 1;
+  }
+  epd_paint_cleardirty();
+
+  if (_epd_back == NULL) {
+    epd_wait_update();
+  }
+  else {
+    memcpy(_epd_back, image, (uint32_t) EPD_Paint.WidthByte * EPD_Paint.HeightByte);
+    EPD_Paint.Image = _epd_back;
+    _epd_back = image;
+  }
+  return 1;
+}
+
+// render the frame band by band into EPD_Paint.Image (Lines rows) and
+// stream the bands that differ from the panel to the RAM selected by cmd;
+// render() draws the whole scene, whatever falls outside the band is
+// clipped. Returns 0 if no band changed
+static uint8_t _epd_writebands(uint8_t cmd, uint16_t Lines, void (*render)(void),
+    uint8_t store) {
+  uint16_t y;
+  uint8_t changed = 0;
+
+  if (_epd_old.Image != NULL) epd_wait_update();
+  for (y = 0; y < EPD_H; y += Lines) {
+    epd_paint_setband(y, Lines);
+    EPD_PROF_START(t);
+    render();
+    EPD_PROF_STOP(EPD_PROF_RENDER, t, 0);
+    if (!_epd_rows_changed(EPD_Paint.Image, y, EPD_Paint.HeightByte)) continue;
+    changed = 1;
+    epd_setpos(0, y);
+    epd_write_reg(cmd);
+    epd_writedata(EPD_Paint.Image, (uint32_t) EPD_Paint.HeightByte * EPD_W_BUFF_SIZE);
+    if (store) _epd_rows_store(EPD_Paint.Image, y, EPD_Paint.HeightByte);
+  }
+  return changed;
+}
+
+void epd_displayBW_banded(uint16_t Lines, void (*render)(void)) {
+  uint16_t y;
+
+  for (y = 0; y < EPD_H; y += Lines) {
+    epd_paint_setband(y, Lines);
+    EPD_PROF_START(t);
+    render();
+    EPD_PROF_STOP(EPD_PROF_RENDER, t, 0);
+    epd_setpos(0, y);
+    epd_write_reg(0x26);
+    epd_writedata(EPD_Paint.Image, (uint32_t) EPD_Paint.HeightByte * EPD_W_BUFF_SIZE);
+    epd_setpos(0, y);
+    epd_write_reg(0x24);
+    epd_writedata(EPD_Paint.Image, (uint32_t) EPD_Paint.HeightByte * EPD_W_BUFF_SIZE);
+    _epd_rows_store(EPD_Paint.Image, y, EPD_Paint.HeightByte);
+  }
+
+  epd_update();
+  _epd_ram_frame = 1;
+  epd_paint_cleardirty();
+}
+
+// the old image (0x26) may only be replaced after the waveform, so the
+// scene is rendered twice
+void epd_displayBW_partial_banded(uint16_t Lines, void (*render)(void)) {
+  if (_epd_writebands(0x24, Lines, render, 0)) {
+    epd_update_partial();
+    _epd_writebands(0x26, Lines, render, 1);
+  }
+  epd_paint_cleardirty();
 }
 
 void epd_displayRED(uint8_t *Image) {
@@ -398,111 +924,633 @@ void epd_displayRED(uint8_t *Image) {
   epd_writedata(Image, Width * Height);
 
   epd_update();
+
+  memset(_epd_rowvalid, 0, sizeof(_epd_rowvalid));
+  _epd_ram_frame = 0;
 }
 
-void epd_paint_newimage(uint8_t *image, uint16_t Width, uint16_t Height, uint16_t Rotate,
-    uint16_t Color) {
-  EPD_Paint.Image = 0x00;
-  EPD_Paint.Image = image;
+typedef struct {
+  const uint8_t *src;
+  uint8_t shift; // 1: high bits (0x24), 0: low bits (0x26)
+} EPD_GRAY_CURSOR;
 
-  EPD_Paint.WidthMemory = Width;
-  EPD_Paint.HeightMemory = Height;
-  EPD_Paint.Color = Color;
-  EPD_Paint.WidthByte = (Width % 8 == 0) ? (Width / 8) : (Width / 8 + 1);
-  EPD_Paint.HeightByte = Height;
-  EPD_Paint.Rotate = Rotate;
-  if (Rotate == EPD_ROTATE_0 || Rotate == EPD_ROTATE_180) {
+// one plane byte from every two bytes (8 pixels) of a 2bpp image
+static void _epd_fill_gray(uint8_t *buf, uint16_t n, void *ctx) {
+  EPD_GRAY_CURSOR *c = ctx;
+  uint16_t x;
 
-    EPD_Paint.Width = Height;
-    EPD_Paint.Height = Width;
-  }
-  else {
-    EPD_Paint.Width = Width;
-    EPD_Paint.Height = Height;
+  while (n--) {
+    x = (c->src[0] << 8 | c->src[1]) >> c->shift & 0x5555;
+    x = (x | x >> 1) & 0x3333;
+    x = (x | x >> 2) & 0x0F0F;
+    *buf++ = x | x >> 4;
+    c->src += 2;
   }
 }
 
-void epd_paint_setpixel(uint16_t Xpoint, uint16_t Ypoint, uint16_t Color) {
-  uint16_t X, Y;
-  uint32_t Addr;
-  uint8_t Rdata;
-  switch (EPD_Paint.Rotate) {
-  case 0:
+// split n rows of a 2bpp image into both RAMs from buffer row y on, each
+// plane converted chunk by chunk while the previous chunk is on the bus
+static void _epd_writegray(const uint8_t *Rows, uint16_t y, uint16_t n) {
+  EPD_GRAY_CURSOR c;
 
-    X = EPD_Paint.WidthMemory - Ypoint - 1;
-    Y = Xpoint;
-    break;
-  case 90:
-    X = EPD_Paint.WidthMemory - Xpoint - 1;
-    Y = EPD_Paint.HeightMemory - Ypoint - 1;
-    break;
-  case 180:
-    X = Ypoint;
-    Y = EPD_Paint.HeightMemory - Xpoint - 1;
-    break;
-  case 270:
-    X = Xpoint;
-    Y = Ypoint;
-    break;
-  default:
-    return;
-  }
-  Addr = X / 8 + Y * EPD_Paint.WidthByte;
-  Rdata = EPD_Paint.Image[Addr];
-  if (Color == EPD_COLOR_BLACK) {
-    EPD_Paint.Image[Addr] = Rdata & ~(0x80 >> (X % 8));
-  }
-  else EPD_Paint.Image[Addr] = Rdata | (0x80 >> (X % 8));
-}
+  c.src = Rows;
+  c.shift = 1;
+  epd_setpos(0, y);
+  epd_write_reg(0x24);
+  epd_cs_reset();
+  _epd_stream_fill(_epd_fill_gray, &c, (uint32_t) n * EPD_W_BUFF_SIZE);
+  epd_cs_set();
 
-void epd_paint_clear(uint16_t color) {
-  uint16_t X, Y;
-  uint32_t Addr;
+  c.src = Rows;
+  c.shift = 0;
+  epd_setpos(0, y);
+  epd_write_reg(0x26);
+  epd_cs_reset();
+  _epd_stream_fill(_epd_fill_gray, &c, (uint32_t) n * EPD_W_BUFF_SIZE);
+  epd_cs_set();
+}
 
-  for (Y = 0; Y < EPD_Paint.HeightByte; Y++) {
-    for (X = 0; X < EPD_Paint.WidthByte; X++) { // 8 pixel =  1 byte
-      Addr = X + Y * EPD_Paint.WidthByte;
-      EPD_Paint.Image[Addr] = color;
-    }
-  }
+static void _epd_update_gray(void) {
+  _epd_update_start(0xC7, NULL);
+  epd_wait_update();
+  memset(_epd_rowvalid, 0, sizeof(_epd_rowvalid));
+  _epd_ram_frame = 0;
 }
 
-void epd_paint_selectimage(uint8_t *image) {
-  EPD_Paint.Image = image;
+void epd_display_gray(uint8_t *Image) {
+  _epd_writegray(Image, 0, EPD_H);
+  _epd_update_gray();
+  if (Image == EPD_Paint.Image) epd_paint_cleardirty();
 }
 
-void epd_paint_drawPoint(uint16_t Xpoint, uint16_t Ypoint, uint16_t Color) {
-  epd_paint_setpixel(Xpoint - 1, Ypoint - 1, Color);
+// EPD_Paint set up with epd_paint_newimage_gray(), see epd_displayBW_banded()
+void epd_display_gray_banded(uint16_t Lines, void (*render)(void)) {
+  uint16_t y;
+
+  for (y = 0; y < EPD_H; y += Lines) {
+    epd_paint_setband(y, Lines);
+    EPD_PROF_START(t);
+    render();
+    EPD_PROF_STOP(EPD_PROF_RENDER, t, 0);
+    _epd_writegray(EPD_Paint.Image, y, EPD_Paint.HeightByte);
+  }
+  _epd_update_gray();
+  epd_paint_cleardirty();
+}
+
+// fill pattern of a color at the depth of EPD_Paint: 2bpp repeats the
+// gray level in every pixel, 1bpp rounds grays to black or white
+static inline uint8_t _epd_ink(uint16_t Color) {
+  switch (Color) {
+  case EPD_COLOR_BLACK:
+    return 0x00;
+  case EPD_COLOR_DARKGRAY:
+    return EPD_Paint.Bpp == 2 ? 0x55 : 0x00;
+  case EPD_COLOR_LIGHTGRAY:
+    return EPD_Paint.Bpp == 2 ? 0xAA : 0xFF;
+  default:
+    return 0xFF;
+  }
+}
+
+// mask of the leftmost pixel in a byte
+#define EPD_PIXEL_MASK ((uint8_t) (0xFF00 >> EPD_Paint.Bpp))
+
+// PackBits: a header n < 128 is followed by n + 1 literal bytes, n > 128
+// by one byte repeated 257 - n times, 128 is a no-op
+typedef struct {
+  const uint8_t *src;
+  uint8_t count; // bytes left in the current run
+  uint8_t repeat;
+} EPD_UNPACK;
+
+static void _epd_unpack_init(EPD_UNPACK *u, const uint8_t *src) {
+  u->src = src;
+  u->count = 0;
+}
+
+static void _epd_unpack(EPD_UNPACK *u, uint8_t *dst, uint16_t n) {
+  uint8_t h, k;
+
+  while (n) {
+    while (!u->count) {
+      h = *u->src++;
+      if (h == 128) continue;
+      u->repeat = h > 128;
+      u->count = u->repeat ? 257 - h : h + 1;
+    }
+    k = n < u->count ? n : u->count;
+    if (u->repeat) {
+      memset(dst, *u->src, k);
+      if (k == u->count) u->src++;
+    }
+    else {
+      memcpy(dst, u->src, k);
+      u->src += k;
+    }
+    u->count -= k;
+    dst += k;
+    n -= k;
+  }
+}
+
+static void _epd_fill_unpack(uint8_t *buf, uint16_t n, void *ctx) {
+  _epd_unpack(ctx, buf, n);
+}
+
+uint8_t epd_writeasset(uint8_t cmd, uint16_t Xstart, uint16_t Ystart, const EPD_ASSET *asset) {
+  uint16_t stride = (asset->Bits + 7) / 8;
+  uint32_t length = (uint32_t) stride * asset->Lines;
+  EPD_UNPACK u;
+
+  if (Xstart % 8 || Xstart / 8 + stride > EPD_W_BUFF_SIZE || Ystart + asset->Lines > EPD_H) {
+    return 1;
+  }
+
+  epd_setwindow(Xstart, Ystart, Xstart + stride * 8 - 1, Ystart + asset->Lines - 1);
+  epd_write_reg(cmd);
+  epd_cs_reset();
+  if (asset->Packed) {
+    _epd_unpack_init(&u, asset->Data);
+    _epd_stream_fill(_epd_fill_unpack, &u, length);
+  }
+  else {
+    _epd_stream(asset->Data, length); // the window is exactly one row wide
+  }
+  epd_cs_set();
+  epd_setwindow(0, 0, EPD_W - 1, EPD_H - 1);
+
+  if (cmd == 0x24) _epd_rows_invalidate(Ystart, asset->Lines);
+  return 0;
+}
+
+uint8_t epd_display_asset(uint16_t Xstart, uint16_t Ystart, const EPD_ASSET *asset) {
+  if (epd_writeasset(0x26, Xstart, Ystart, asset)) return 1;
+  epd_writeasset(0x24, Xstart, Ystart, asset);
+  epd_update();
+  return 0;
+}
+
+// memory-space writers shared by all rotations
+static inline void _epd_plot(uint16_t X, uint16_t Y, uint16_t Color) {
+  uint8_t *p, m;
+  uint32_t bit = (uint32_t) X * EPD_Paint.Bpp;
+
+  if (X >= EPD_Paint.WidthMemory || Y < EPD_Paint.BandStart || Y > EPD_Paint.BandEnd) return;
+  if (X < EPD_Paint.DirtyXStart) EPD_Paint.DirtyXStart = X;
+  if (X > EPD_Paint.DirtyXEnd) EPD_Paint.DirtyXEnd = X;
+  if (Y < EPD_Paint.DirtyYStart) EPD_Paint.DirtyYStart = Y;
+  if (Y > EPD_Paint.DirtyYEnd) EPD_Paint.DirtyYEnd = Y;
+  p = &EPD_Paint.Image[bit / 8 + (Y - EPD_Paint.BandStart) * EPD_Paint.WidthByte];
+  m = EPD_PIXEL_MASK >> (bit % 8);
+  *p = (*p & ~m) | (_epd_ink(Color) & m);
+}
+
+static void _epd_markdirty(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend) {
+  if (Xstart < EPD_Paint.DirtyXStart) EPD_Paint.DirtyXStart = Xstart;
+  if (Xend > EPD_Paint.DirtyXEnd) EPD_Paint.DirtyXEnd = Xend;
+  if (Ystart < EPD_Paint.DirtyYStart) EPD_Paint.DirtyYStart = Ystart;
+  if (Yend > EPD_Paint.DirtyYEnd) EPD_Paint.DirtyYEnd = Yend;
+}
+
+// n pixels along a memory row, X increasing: masked edge bytes, whole
+// bytes in between
+static void _epd_run_x(int32_t X, int32_t Y, int32_t n, uint16_t Color) {
+  uint8_t *p;
+  uint8_t first, last, ink = _epd_ink(Color);
+  uint32_t bit, end, bytes;
+
+  if (Y < EPD_Paint.BandStart || Y > EPD_Paint.BandEnd) return;
+  if (X < 0) {
+    n += X;
+    X = 0;
+  }
+  if (X + n > EPD_Paint.WidthMemory) n = EPD_Paint.WidthMemory - X;
+  if (n <= 0) return;
+  _epd_markdirty(X, Y, X + n - 1, Y);
+
+  bit = (uint32_t) X * EPD_Paint.Bpp;
+  end = (uint32_t) (X + n) * EPD_Paint.Bpp - 1; // last bit
+  p = &EPD_Paint.Image[bit / 8 + (Y - EPD_Paint.BandStart) * EPD_Paint.WidthByte];
+  first = 0xFF >> (bit % 8);
+  last = 0xFF << (7 - end % 8);
+  bytes = end / 8 - bit / 8;
+  if (!bytes) {
+    first &= last;
+    *p = (*p & ~first) | (ink & first);
+    return;
+  }
+  *p = (*p & ~first) | (ink & first);
+  memset(p + 1, ink, bytes - 1);
+  p += bytes;
+  *p = (*p & ~last) | (ink & last);
+}
+
+// W x H pixels of memory space, clipped to the band
+static void _epd_fill_mem(int32_t X, int32_t Y, int32_t W, int32_t H, uint16_t Color) {
+  int32_t Yend = Y + H - 1;
+
+  if (Y < EPD_Paint.BandStart) Y = EPD_Paint.BandStart;
+  if (Yend > EPD_Paint.BandEnd) Yend = EPD_Paint.BandEnd;
+  for (; Y <= Yend; Y++) {
+    _epd_run_x(X, Y, W, Color);
+  }
+}
+
+// n pixels along a memory column, Y increasing
+static void _epd_run_y(int32_t X, int32_t Y, int32_t n, uint16_t Color) {
+  uint8_t *p;
+  uint8_t mask, ink = _epd_ink(Color);
+  uint32_t bit;
+
+  if (X < 0 || X >= EPD_Paint.WidthMemory) return;
+  if (Y < EPD_Paint.BandStart) {
+    n -= EPD_Paint.BandStart - Y;
+    Y = EPD_Paint.BandStart;
+  }
+  if (Y + n > EPD_Paint.BandEnd + 1) n = EPD_Paint.BandEnd + 1 - Y;
+  if (n <= 0) return;
+  _epd_markdirty(X, Y, X, Y + n - 1);
+
+  bit = (uint32_t) X * EPD_Paint.Bpp;
+  p = &EPD_Paint.Image[bit / 8 + (Y - EPD_Paint.BandStart) * EPD_Paint.WidthByte];
+  mask = EPD_PIXEL_MASK >> (bit % 8);
+  while (n--) {
+    *p = (*p & ~mask) | (ink & mask);
+    p += EPD_Paint.WidthByte;
+  }
+}
+
+// per-rotation writers, picked once in epd_paint_newimage()
+static void _epd_setpixel_0(uint16_t Xpoint, uint16_t Ypoint, uint16_t Color) {
+  _epd_plot(EPD_Paint.WidthMemory - Ypoint - 1, Xpoint, Color);
+}
+
+static void _epd_setpixel_90(uint16_t Xpoint, uint16_t Ypoint, uint16_t Color) {
+  _epd_plot(EPD_Paint.WidthMemory - Xpoint - 1, EPD_Paint.HeightMemory - Ypoint - 1, Color);
+}
+
+static void _epd_setpixel_180(uint16_t Xpoint, uint16_t Ypoint, uint16_t Color) {
+  _epd_plot(Ypoint, EPD_Paint.HeightMemory - Xpoint - 1, Color);
+}
+
+static void _epd_setpixel_270(uint16_t Xpoint, uint16_t Ypoint, uint16_t Color) {
+  _epd_plot(Xpoint, Ypoint, Color);
+}
+
+static void _epd_hspan_0(uint16_t Xpoint, uint16_t Ypoint, uint16_t Len, uint16_t Color) {
+  _epd_run_y(EPD_Paint.WidthMemory - Ypoint - 1, Xpoint, Len, Color);
+}
+
+static void _epd_hspan_90(uint16_t Xpoint, uint16_t Ypoint, uint16_t Len, uint16_t Color) {
+  _epd_run_x(EPD_Paint.WidthMemory - Xpoint - Len, EPD_Paint.HeightMemory - Ypoint - 1, Len,
+      Color);
+}
+
+static void _epd_hspan_180(uint16_t Xpoint, uint16_t Ypoint, uint16_t Len, uint16_t Color) {
+  _epd_run_y(Ypoint, EPD_Paint.HeightMemory - Xpoint - Len, Len, Color);
+}
+
+static void _epd_hspan_270(uint16_t Xpoint, uint16_t Ypoint, uint16_t Len, uint16_t Color) {
+  _epd_run_x(Xpoint, Ypoint, Len, Color);
+}
+
+static void _epd_vspan_0(uint16_t Xpoint, uint16_t Ypoint, uint16_t Len, uint16_t Color) {
+  _epd_run_x(EPD_Paint.WidthMemory - Ypoint - Len, Xpoint, Len, Color);
+}
+
+static void _epd_vspan_90(uint16_t Xpoint, uint16_t Ypoint, uint16_t Len, uint16_t Color) {
+  _epd_run_y(EPD_Paint.WidthMemory - Xpoint - 1, EPD_Paint.HeightMemory - Ypoint - Len, Len,
+      Color);
+}
+
+static void _epd_vspan_180(uint16_t Xpoint, uint16_t Ypoint, uint16_t Len, uint16_t Color) {
+  _epd_run_x(Ypoint, EPD_Paint.HeightMemory - Xpoint - 1, Len, Color);
+}
+
+static void _epd_vspan_270(uint16_t Xpoint, uint16_t Ypoint, uint16_t Len, uint16_t Color) {
+  _epd_run_y(Xpoint, Ypoint, Len, Color);
+}
+
+// memory rectangle covered by a logical w x h rectangle at (x, y)
+static void _epd_maprect_0(int32_t x, int32_t y, int32_t w, int32_t h, int32_t *X, int32_t *Y) {
+  *X = EPD_Paint.WidthMemory - y - h;
+  *Y = x;
+}
+
+static void _epd_maprect_90(int32_t x, int32_t y, int32_t w, int32_t h, int32_t *X, int32_t *Y) {
+  *X = EPD_Paint.WidthMemory - x - w;
+  *Y = EPD_Paint.HeightMemory - y - h;
+}
+
+static void _epd_maprect_180(int32_t x, int32_t y, int32_t w, int32_t h, int32_t *X, int32_t *Y) {
+  *X = y;
+  *Y = EPD_Paint.HeightMemory - x - w;
+}
+
+static void _epd_maprect_270(int32_t x, int32_t y, int32_t w, int32_t h, int32_t *X, int32_t *Y) {
+  *X = x;
+  *Y = y;
+}
+
+static void _epd_maprect_none(int32_t x, int32_t y, int32_t w, int32_t h, int32_t *X, int32_t *Y) {
+  *X = -(w + h); // off the image either way round
+  *Y = -(w + h);
+}
+
+static void _epd_setpixel_none(uint16_t Xpoint, uint16_t Ypoint, uint16_t Color) {
+}
+
+static void _epd_span_none(uint16_t Xpoint, uint16_t Ypoint, uint16_t Len, uint16_t Color) {
+}
+
+typedef struct {
+  void (*setpixel)(uint16_t Xpoint, uint16_t Ypoint, uint16_t Color);
+  void (*hspan)(uint16_t Xpoint, uint16_t Ypoint, uint16_t Len, uint16_t Color);
+  void (*vspan)(uint16_t Xpoint, uint16_t Ypoint, uint16_t Len, uint16_t Color);
+  void (*maprect)(int32_t x, int32_t y, int32_t w, int32_t h, int32_t *X, int32_t *Y);
+} EPD_PAINT_OPS;
+
+static const EPD_PAINT_OPS _epd_paint_ops[] = {
+  { _epd_setpixel_0, _epd_hspan_0, _epd_vspan_0, _epd_maprect_0 },
+  { _epd_setpixel_90, _epd_hspan_90, _epd_vspan_90, _epd_maprect_90 },
+  { _epd_setpixel_180, _epd_hspan_180, _epd_vspan_180, _epd_maprect_180 },
+  { _epd_setpixel_270, _epd_hspan_270, _epd_vspan_270, _epd_maprect_270 },
+  { _epd_setpixel_none, _epd_span_none, _epd_span_none, _epd_maprect_none },
+};
+
+static const EPD_PAINT_OPS *_epd_ops = &_epd_paint_ops[4];
+
+// logical w x h rectangle at (x, y), 0-based, clipped
+static void _epd_fill_rect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t Color) {
+  int32_t X, Y;
+
+  if (w <= 0 || h <= 0) return;
+  _epd_ops->maprect(x, y, w, h, &X, &Y);
+  if (EPD_Paint.Rotate == EPD_ROTATE_0 || EPD_Paint.Rotate == EPD_ROTATE_180) {
+    _epd_fill_mem(X, Y, h, w, Color);
+  }
+  else {
+    _epd_fill_mem(X, Y, w, h, Color);
+  }
+}
+
+// line of a disc at distance d from its center, 2 * half + 1 long; runs
+// along the memory rows: circle columns at 0/180, circle rows at 90/270
+static void _epd_disc_span(int32_t cx, int32_t cy, int32_t d, int32_t half, uint16_t Color) {
+  if (EPD_Paint.Rotate == EPD_ROTATE_0 || EPD_Paint.Rotate == EPD_ROTATE_180) {
+    _epd_fill_rect(cx + d, cy - half, 1, 2 * half + 1, Color);
+  }
+  else {
+    _epd_fill_rect(cx - half, cy + d, 2 * half + 1, 1, Color);
+  }
+}
+
+static void _epd_point(int32_t x, int32_t y, uint16_t Color) {
+  if (x >= 0 && y >= 0) _epd_ops->setpixel(x, y, Color);
+}
+
+void epd_paint_newimage(uint8_t *image, uint16_t Width, uint16_t Height, uint16_t Rotate,
+    uint16_t Color) {
+  EPD_Paint.Image = 0x00;
+  EPD_Paint.Image = image;
+
+  EPD_Paint.WidthMemory = Width;
+  EPD_Paint.HeightMemory = Height;
+  EPD_Paint.Color = Color;
+  EPD_Paint.WidthByte = (Width % 8 == 0) ? (Width / 8) : (Width / 8 + 1);
+  EPD_Paint.HeightByte = Height;
+  EPD_Paint.Bpp = 1;
+  EPD_Paint.BandStart = 0;
+  EPD_Paint.BandEnd = Height - 1;
+  EPD_Paint.Rotate = Rotate;
+  // nothing says the buffer matches the panel RAM, so all of it is dirty
+  epd_paint_cleardirty();
+  _epd_markdirty(0, 0, Width - 1, Height - 1);
+  if (Rotate == EPD_ROTATE_0 || Rotate == EPD_ROTATE_180) {
+
+    EPD_Paint.Width = Height;
+    EPD_Paint.Height = Width;
+  }
+  else {
+    EPD_Paint.Width = Width;
+    EPD_Paint.Height = Height;
+  }
+
+  switch (Rotate) {
+  case EPD_ROTATE_0:
+    _epd_ops = &_epd_paint_ops[0];
+    break;
+  case EPD_ROTATE_90:
+    _epd_ops = &_epd_paint_ops[1];
+    break;
+  case EPD_ROTATE_180:
+    _epd_ops = &_epd_paint_ops[2];
+    break;
+  case EPD_ROTATE_270:
+    _epd_ops = &_epd_paint_ops[3];
+    break;
+  default:
+    _epd_ops = &_epd_paint_ops[4];
+    break;
+  }
+}
+
+// 2 bits per pixel; rows are padded like the 1bpp ones, so one byte of
+// the panel RAM always comes from two bytes of the image
+void epd_paint_newimage_gray(uint8_t *image, uint16_t Width, uint16_t Height, uint16_t Rotate,
+    uint16_t Color) {
+  epd_paint_newimage(image, Width, Height, Rotate, Color);
+  EPD_Paint.WidthByte *= 2;
+  EPD_Paint.Bpp = 2;
+}
+
+void epd_paint_setpixel(uint16_t Xpoint, uint16_t Ypoint, uint16_t Color) {
+  _epd_ops->setpixel(Xpoint, Ypoint, Color);
+}
+
+void epd_paint_clear(uint16_t color) {
+  uint16_t X, Y;
+  uint32_t Addr;
+  uint8_t ink = _epd_ink(color);
+
+  for (Y = 0; Y < EPD_Paint.HeightByte; Y++) {
+    for (X = 0; X < EPD_Paint.WidthByte; X++) { // 8 pixel =  1 byte
+      Addr = X + Y * EPD_Paint.WidthByte;
+      EPD_Paint.Image[Addr] = ink;
+    }
+  }
+  _epd_markdirty(0, EPD_Paint.BandStart, EPD_Paint.WidthMemory - 1, EPD_Paint.BandEnd);
+}
+
+void epd_paint_setband(uint16_t Start, uint16_t Lines) {
+  if (Start >= EPD_Paint.HeightMemory || Lines == 0) return;
+  if (Start + Lines > EPD_Paint.HeightMemory) Lines = EPD_Paint.HeightMemory - Start;
+  EPD_Paint.BandStart = Start;
+  EPD_Paint.BandEnd = Start + Lines - 1;
+  EPD_Paint.HeightByte = Lines;
+}
+
+void epd_paint_cleardirty(void) {
+  EPD_Paint.DirtyXStart = 0xFFFF;
+  EPD_Paint.DirtyYStart = 0xFFFF;
+  EPD_Paint.DirtyXEnd = 0;
+  EPD_Paint.DirtyYEnd = 0;
+}
+
+uint8_t epd_paint_isdirty(void) {
+  return EPD_Paint.DirtyXStart <= EPD_Paint.DirtyXEnd;
+}
+
+// an image still owned by a running update is waited for; selecting the
+// second buffer swaps the two. Another image makes all of it dirty: the
+// dirty area of partial updates must hold every difference to the RAM
+void epd_paint_selectimage(uint8_t *image) {
+  if (image == _epd_old.Image) epd_wait_update();
+  if (image == _epd_back) _epd_back = EPD_Paint.Image;
+  if (image != EPD_Paint.Image) {
+    _epd_markdirty(0, 0, EPD_Paint.WidthMemory - 1, EPD_Paint.HeightMemory - 1);
+  }
+  EPD_Paint.Image = image;
+}
+
+// second frame buffer of the size of EPD_Paint.Image for
+// epd_displayBW_async(), NULL for none; whole frames only, no bands
+void epd_paint_doublebuffer(uint8_t *image) {
+  if (_epd_back != NULL && _epd_back == _epd_old.Image) epd_wait_update();
+  _epd_back = image;
+}
+
+void epd_paint_drawPoint(uint16_t Xpoint, uint16_t Ypoint, uint16_t Color) {
+  _epd_ops->setpixel(Xpoint - 1, Ypoint - 1, Color);
+}
+
+#define EPD_CLIP_LEFT 0x01
+#define EPD_CLIP_RIGHT 0x02
+#define EPD_CLIP_TOP 0x04
+#define EPD_CLIP_BOTTOM 0x08
+
+static uint8_t _epd_outcode(int32_t x, int32_t y) {
+  uint8_t code = 0;
+
+  if (x < 0) code |= EPD_CLIP_LEFT;
+  else if (x >= EPD_Paint.Width) code |= EPD_CLIP_RIGHT;
+  if (y < 0) code |= EPD_CLIP_TOP;
+  else if (y >= EPD_Paint.Height) code |= EPD_CLIP_BOTTOM;
+  return code;
+}
+
+// a + d * num / den, rounded to the nearest pixel
+static int32_t _epd_lerp(int32_t a, int32_t d, int32_t num, int32_t den) {
+  int64_t q = (int64_t) d * num;
+
+  if (den < 0) {
+    den = -den;
+    q = -q;
+  }
+  return a + (int32_t) (q >= 0 ? (2 * q + den) / (2 * den) : -((-2 * q + den) / (2 * den)));
+}
+
+// Cohen-Sutherland: move the ends of (x0, y0)-(x1, y1) onto the paint
+// area, 0-based; 0 when the line misses it
+static uint8_t _epd_clipline(int32_t *x0, int32_t *y0, int32_t *x1, int32_t *y1) {
+  int32_t X0 = *x0, Y0 = *y0, dx = *x1 - *x0, dy = *y1 - *y0;
+  int32_t x, y;
+  uint8_t c0 = _epd_outcode(*x0, *y0), c1 = _epd_outcode(*x1, *y1), c;
+
+  for (;;) {
+    if (!(c0 | c1)) return 1;
+    if (c0 & c1) return 0;
+    c = c0 ? c0 : c1;
+    // intersections are taken on the original line, not the shortened one
+    if (c & (EPD_CLIP_TOP | EPD_CLIP_BOTTOM)) {
+      y = c & EPD_CLIP_TOP ? 0 : EPD_Paint.Height - 1;
+      x = _epd_lerp(X0, dx, y - Y0, dy);
+    }
+    else {
+      x = c & EPD_CLIP_LEFT ? 0 : EPD_Paint.Width - 1;
+      y = _epd_lerp(Y0, dy, x - X0, dx);
+    }
+    if (c == c0) {
+      *x0 = x;
+      *y0 = y;
+      c0 = _epd_outcode(x, y);
+    }
+    else {
+      *x1 = x;
+      *y1 = y;
+      c1 = _epd_outcode(x, y);
+    }
+  }
+}
+
+// straight line from a0 to a1, along x at y = b or along y at x = b; each
+// run of set pattern bits becomes one span
+static void _epd_line_straight(int32_t a0, int32_t a1, int32_t b, uint8_t vertical,
+    uint8_t phase, uint16_t Pattern, uint16_t Color) {
+  int32_t step = a0 <= a1 ? 1 : -1, n = (a1 - a0) * step + 1, i = 0, j, lo;
+
+  while (i < n) {
+    if (!(Pattern >> ((phase + i) & 15) & 1)) {
+      i++;
+      continue;
+    }
+    for (j = i + 1; j < n && (Pattern >> ((phase + j) & 15) & 1); j++)
+      ;
+    lo = step > 0 ? a0 + i : a0 - (j - 1);
+    if (vertical) _epd_ops->vspan(b, lo, j - i, Color);
+    else _epd_ops->hspan(lo, b, j - i, Color);
+    i = j;
+  }
 }
 
 void epd_paint_drawLine(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend,
     uint16_t Color) {
-  uint16_t Xpoint, Ypoint;
+  epd_paint_drawLineStyle(Xstart, Ystart, Xend, Yend, Color, EPD_LINE_SOLID);
+}
+
+void epd_paint_drawLineStyle(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend,
+    uint16_t Color, uint16_t Pattern) {
+  int32_t Xpoint = (int32_t) Xstart - 1, Ypoint = (int32_t) Ystart - 1;
+  int32_t X1 = (int32_t) Xend - 1, Y1 = (int32_t) Yend - 1;
   int32_t dx, dy;
   int32_t XAddway, YAddway;
   int32_t Esp;
-  char Dotted_Len;
-  Xpoint = Xstart;
-  Ypoint = Ystart;
-  dx = (int) Xend - (int) Xstart >= 0 ? Xend - Xstart : Xstart - Xend;
-  dy = (int) Yend - (int) Ystart <= 0 ? Yend - Ystart : Ystart - Yend;
+  uint8_t phase;
+
+  if (!_epd_clipline(&Xpoint, &Ypoint, &X1, &Y1)) return;
+  // one pattern bit per step along the major axis
+  dx = Xpoint - (Xstart - 1) >= 0 ? Xpoint - (Xstart - 1) : (Xstart - 1) - Xpoint;
+  dy = Ypoint - (Ystart - 1) >= 0 ? Ypoint - (Ystart - 1) : (Ystart - 1) - Ypoint;
+  phase = (dx > dy ? dx : dy) & 15;
+
+  if (Ypoint == Y1) {
+    _epd_line_straight(Xpoint, X1, Ypoint, 0, phase, Pattern, Color);
+    return;
+  }
+  if (Xpoint == X1) {
+    _epd_line_straight(Ypoint, Y1, Xpoint, 1, phase, Pattern, Color);
+    return;
+  }
+
+  dx = X1 - Xpoint >= 0 ? X1 - Xpoint : Xpoint - X1;
+  dy = Y1 - Ypoint <= 0 ? Y1 - Ypoint : Ypoint - Y1;
 
-  XAddway = Xstart < Xend ? 1 : -1;
-  YAddway = Ystart < Yend ? 1 : -1;
+  XAddway = Xpoint < X1 ? 1 : -1;
+  YAddway = Ypoint < Y1 ? 1 : -1;
 
   Esp = dx + dy;
-  Dotted_Len = 0;
 
+  // both ends are inside, so is every pixel in between
   for (;;) {
-    Dotted_Len++;
-    epd_paint_drawPoint(Xpoint, Ypoint, Color);
+    if (Pattern >> (phase++ & 15) & 1) _epd_ops->setpixel(Xpoint, Ypoint, Color);
     if (2 * Esp >= dy) {
-      if (Xpoint == Xend) break;
+      if (Xpoint == X1) break;
       Esp += dy;
       Xpoint += XAddway;
     }
     if (2 * Esp <= dx) {
-      if (Ypoint == Yend) break;
+      if (Ypoint == Y1) break;
       Esp += dx;
       Ypoint += YAddway;
     }
@@ -511,11 +1559,12 @@ void epd_paint_drawLine(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_
 
 void epd_paint_drawRectangle(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend,
     uint16_t Color, uint8_t mode) {
-  uint16_t i;
+  int32_t x0 = Xstart < Xend ? Xstart : Xend;
+  int32_t x1 = Xstart < Xend ? Xend : Xstart;
+
   if (mode) {
-    for (i = Ystart; i < Yend; i++) {
-      epd_paint_drawLine(Xstart, i, Xend, i, Color);
-    }
+    // rows Ystart..Yend - 1, as the line by line fill always did
+    _epd_fill_rect(x0 - 1, Ystart - 1, x1 - x0 + 1, (int32_t) Yend - Ystart, Color);
   }
   else {
     epd_paint_drawLine(Xstart, Ystart, Xend, Ystart, Color);
@@ -527,25 +1576,23 @@ void epd_paint_drawRectangle(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, ui
 
 void epd_paint_drawCircle(uint16_t X_Center, uint16_t Y_Center, uint16_t Radius, uint16_t Color,
     uint8_t mode) {
-  uint16_t Esp, sCountY;
-  uint16_t XCurrent, YCurrent;
+  int32_t Esp;
+  int32_t XCurrent, YCurrent;
   XCurrent = 0;
   YCurrent = Radius;
   Esp = 3 - (Radius << 1);
   if (mode) {
-    while (XCurrent <= YCurrent) { // Realistic circles
-      for (sCountY = XCurrent; sCountY <= YCurrent; sCountY++) {
-        epd_paint_drawPoint(X_Center + XCurrent, Y_Center + sCountY, Color); // 1
-        epd_paint_drawPoint(X_Center - XCurrent, Y_Center + sCountY, Color); // 2
-        epd_paint_drawPoint(X_Center - sCountY, Y_Center + XCurrent, Color); // 3
-        epd_paint_drawPoint(X_Center - sCountY, Y_Center - XCurrent, Color); // 4
-        epd_paint_drawPoint(X_Center - XCurrent, Y_Center - sCountY, Color); // 5
-        epd_paint_drawPoint(X_Center + XCurrent, Y_Center - sCountY, Color); // 6
-        epd_paint_drawPoint(X_Center + sCountY, Y_Center - XCurrent, Color); // 7
-        epd_paint_drawPoint(X_Center + sCountY, Y_Center + XCurrent, Color);
-      }
-      if ((int) Esp < 0) Esp += 4 * XCurrent + 6;
+    // one span per line of the disc: lines +-XCurrent reach out to
+    // YCurrent, lines +-YCurrent to XCurrent before YCurrent steps in
+    while (XCurrent <= YCurrent) {
+      _epd_disc_span(X_Center - 1, Y_Center - 1, XCurrent, YCurrent, Color);
+      if (XCurrent) _epd_disc_span(X_Center - 1, Y_Center - 1, -XCurrent, YCurrent, Color);
+      if (Esp < 0) Esp += 4 * XCurrent + 6;
       else {
+        if (YCurrent > XCurrent) {
+          _epd_disc_span(X_Center - 1, Y_Center - 1, YCurrent, XCurrent, Color);
+          _epd_disc_span(X_Center - 1, Y_Center - 1, -YCurrent, XCurrent, Color);
+        }
         Esp += 10 + 4 * (XCurrent - YCurrent);
         YCurrent--;
       }
@@ -562,7 +1609,7 @@ void epd_paint_drawCircle(uint16_t X_Center, uint16_t Y_Center, uint16_t Radius,
       epd_paint_drawPoint(X_Center + XCurrent, Y_Center - YCurrent, Color); // 6
       epd_paint_drawPoint(X_Center + YCurrent, Y_Center - XCurrent, Color); // 7
       epd_paint_drawPoint(X_Center + YCurrent, Y_Center + XCurrent, Color); // 0
-      if ((int) Esp < 0) Esp += 4 * XCurrent + 6;
+      if (Esp < 0) Esp += 4 * XCurrent + 6;
       else {
         Esp += 10 + 4 * (XCurrent - YCurrent);
         YCurrent--;
@@ -572,43 +1619,251 @@ void epd_paint_drawCircle(uint16_t X_Center, uint16_t Y_Center, uint16_t Radius,
   }
 }
 
-void epd_paint_showChar(uint16_t x, uint16_t y, uint16_t chr, uint16_t size1, uint16_t color) {
-  uint16_t i, m, temp, size2, chr1;
-  uint16_t x0, y0;
-  x += 1, y += 1, x0 = x, y0 = y;
-  if (x - size1 > EPD_H) return;
-  if (size1 == 8) size2 = 6;
-  else size2 = (size1 / 8 + ((size1 % 8) ? 1 : 0)) * (size1 / 2);
-  chr1 = chr - ' ';
-  for (i = 0; i < size2; i++) {
-    if (size1 == 8) {
-      temp = asc2_0806[chr1][i];
-    } // 0806
-    else if (size1 == 12) {
-      temp = asc2_1206[chr1][i];
-    } // 1206
-    else if (size1 == 16) {
-      temp = asc2_1608[chr1][i];
-    } // 1608
-    else if (size1 == 24) {
-      temp = asc2_2412[chr1][i];
-    } // 2412
-    else return;
-    for (m = 0; m < 8; m++) {
-      if (temp & 0x01) epd_paint_drawPoint(x, y, color);
-      else epd_paint_drawPoint(x, y, !color);
-      temp >>= 1;
-      y++;
+// box with quarter circle corners; coordinates as for drawRectangle, but
+// Yend is inclusive for the filled box too
+void epd_paint_drawRoundRect(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend,
+    uint16_t Radius, uint16_t Color, uint8_t mode) {
+  int32_t x0 = (Xstart < Xend ? Xstart : Xend) - 1, x1 = (Xstart < Xend ? Xend : Xstart) - 1;
+  int32_t y0 = (Ystart < Yend ? Ystart : Yend) - 1, y1 = (Ystart < Yend ? Yend : Ystart) - 1;
+  int32_t r = Radius, w, h, Esp, XCurrent = 0, YCurrent;
+
+  if (2 * r > x1 - x0) r = (x1 - x0) / 2;
+  if (2 * r > y1 - y0) r = (y1 - y0) / 2;
+  w = x1 - x0 + 1 - 2 * r; // straight part of the edges
+  h = y1 - y0 + 1 - 2 * r;
+  if (mode) {
+    _epd_fill_rect(x0, y0 + r, x1 - x0 + 1, h, Color);
+  }
+  else {
+    _epd_fill_rect(x0 + r, y0, w, 1, Color);
+    _epd_fill_rect(x0 + r, y1, w, 1, Color);
+    _epd_fill_rect(x0, y0 + r, 1, h, Color);
+    _epd_fill_rect(x1, y0 + r, 1, h, Color);
+  }
+
+  // corner centers are (x0 + r, y0 + r) .. (x1 - r, y1 - r)
+  YCurrent = r;
+  Esp = 3 - 2 * r;
+  while (XCurrent <= YCurrent) {
+    if (mode) {
+      _epd_fill_rect(x0 + r - YCurrent, y0 + r - XCurrent, w + 2 * YCurrent, 1, Color);
+      _epd_fill_rect(x0 + r - YCurrent, y1 - r + XCurrent, w + 2 * YCurrent, 1, Color);
+      if (Esp >= 0 && YCurrent > XCurrent) {
+        _epd_fill_rect(x0 + r - XCurrent, y0 + r - YCurrent, w + 2 * XCurrent, 1, Color);
+        _epd_fill_rect(x0 + r - XCurrent, y1 - r + YCurrent, w + 2 * XCurrent, 1, Color);
+      }
     }
-    x++;
-    if ((size1 != 8) && ((x - x0) == size1 / 2)) {
-      x = x0;
-      y0 = y0 + 8;
+    else {
+      _epd_point(x0 + r - XCurrent, y0 + r - YCurrent, Color);
+      _epd_point(x0 + r - YCurrent, y0 + r - XCurrent, Color);
+      _epd_point(x1 - r + XCurrent, y0 + r - YCurrent, Color);
+      _epd_point(x1 - r + YCurrent, y0 + r - XCurrent, Color);
+      _epd_point(x0 + r - XCurrent, y1 - r + YCurrent, Color);
+      _epd_point(x0 + r - YCurrent, y1 - r + XCurrent, Color);
+      _epd_point(x1 - r + XCurrent, y1 - r + YCurrent, Color);
+      _epd_point(x1 - r + YCurrent, y1 - r + XCurrent, Color);
+    }
+    if (Esp < 0) Esp += 4 * XCurrent + 6;
+    else {
+      Esp += 10 + 4 * (XCurrent - YCurrent);
+      YCurrent--;
+    }
+    XCurrent++;
+  }
+}
+
+// merge up to 8 bitmap pixels g (valid where m is set) into *p
+static inline void _epd_mergebyte(uint8_t *p, uint8_t g, uint8_t m, uint16_t Color,
+    uint8_t Opaque) {
+  if (!Opaque) m &= g;
+  if (!_epd_ink(Color)) g = ~g;
+  *p = (*p & ~m) | (g & m);
+}
+
+// copy one memory row of up to 32 pixels (MSB first in Row) to X0, Y;
+// opaque blits paint the unset pixels with the opposite color
+static void _epd_blitline(int32_t X0, int32_t Y, uint16_t Bits, uint32_t Row, uint16_t Color,
+    uint8_t Opaque) {
+  uint16_t k, b;
+  uint8_t s, g, m, *p;
+  uint16_t Back = EPD_COLOR_BACK(Color);
+
+  if (Y < EPD_Paint.BandStart || Y > EPD_Paint.BandEnd) return;
+  if (EPD_Paint.Bpp != 1 || X0 < 0 || X0 + Bits > EPD_Paint.WidthMemory) {
+    for (b = 0; b < Bits; b++) {
+      if (Row & (0x80000000UL >> b)) _epd_plot(X0 + b, Y, Color);
+      else if (Opaque) _epd_plot(X0 + b, Y, Back);
+    }
+    return;
+  }
+
+  _epd_markdirty(X0, Y, X0 + Bits - 1, Y);
+  s = X0 % 8;
+  p = &EPD_Paint.Image[X0 / 8 + (Y - EPD_Paint.BandStart) * EPD_Paint.WidthByte];
+  for (k = 0, b = Bits; b; k++, Row <<= 8) {
+    g = Row >> 24;
+    m = b >= 8 ? 0xFF : (uint8_t) (0xFF00 >> b);
+    b = b >= 8 ? b - 8 : 0;
+    _epd_mergebyte(p + k, g >> s, m >> s, Color, Opaque);
+    if (s && (uint8_t) (m << (8 - s))) {
+      _epd_mergebyte(p + k + 1, g << (8 - s), m << (8 - s), Color, Opaque);
+    }
+  }
+}
+
+// copy Bits pixels of a memory row (MSB first) to X0, Y: whole bytes when
+// X0 is byte aligned, shifted into place 32 pixels at a time otherwise
+static void _epd_copyrow(int32_t X0, int32_t Y, const uint8_t *Src, uint16_t Bits) {
+  uint8_t *p;
+  uint16_t b, k, n;
+  uint32_t row;
+
+  if (Y < EPD_Paint.BandStart || Y > EPD_Paint.BandEnd) return;
+  if (EPD_Paint.Bpp == 1 && X0 >= 0 && X0 % 8 == 0 && X0 + Bits <= EPD_Paint.WidthMemory) {
+    _epd_markdirty(X0, Y, X0 + Bits - 1, Y);
+    p = &EPD_Paint.Image[X0 / 8 + (Y - EPD_Paint.BandStart) * EPD_Paint.WidthByte];
+    memcpy(p, Src, Bits / 8);
+    if (Bits % 8) {
+      _epd_mergebyte(p + Bits / 8, Src[Bits / 8], (uint8_t) (0xFF00 >> (Bits % 8)),
+          EPD_COLOR_WHITE, 1);
+    }
+    return;
+  }
+
+  for (b = 0; b < Bits; b += 32) {
+    n = Bits - b < 32 ? Bits - b : 32;
+    row = 0;
+    for (k = 0; k < (n + 7) / 8; k++) {
+      row |= (uint32_t) Src[b / 8 + k] << (24 - 8 * k);
+    }
+    _epd_blitline(X0 + b, Y, n, row, EPD_COLOR_WHITE, 1);
+  }
+}
+
+// cell pixel (gx, gy) stored at memory row l, bit b of a w x h cell laid
+// out for rotation Rotate (fonts, assets)
+static void _epd_native_xy(uint16_t Rotate, uint16_t w, uint16_t h, uint16_t l, uint16_t b,
+    uint16_t *gx, uint16_t *gy) {
+  switch (Rotate) {
+  case EPD_ROTATE_0:
+    *gx = l, *gy = h - 1 - b;
+    break;
+  case EPD_ROTATE_90:
+    *gx = w - 1 - b, *gy = h - 1 - l;
+    break;
+  case EPD_ROTATE_180:
+    *gx = w - 1 - l, *gy = b;
+    break;
+  default:
+    *gx = b, *gy = l;
+    break;
+  }
+}
+
+// read position in a font bit stream and ink box of the current glyph
+typedef struct {
+  const uint8_t *Data;
+  uint32_t Pos;
+  uint16_t Line0, Lines, Bit0, Bits;
+} EPD_GLYPH;
+
+// next n (<= 24) bits of the stream, MSB first
+static uint32_t _epd_getbits(EPD_GLYPH *g, uint8_t n) {
+  uint32_t v = 0;
+  uint8_t k, r;
+
+  while (n) {
+    r = 8 - (g->Pos % 8);
+    k = n < r ? n : r;
+    v = (v << k) | ((g->Data[g->Pos / 8] >> (r - k)) & ((1 << k) - 1));
+    g->Pos += k;
+    n -= k;
+  }
+  return v;
+}
+
+static void _epd_glyph_header(EPD_GLYPH *g, const EPD_FONT *font) {
+  g->Line0 = _epd_getbits(g, font->LineField);
+  g->Lines = _epd_getbits(g, font->LineField);
+  g->Bit0 = _epd_getbits(g, font->BitField);
+  g->Bits = _epd_getbits(g, font->BitField);
+}
+
+// position the stream on the box of chr, skipping at most
+// EPD_FONT_INDEX_STEP - 1 glyphs after the nearest index entry
+static void _epd_glyph_seek(EPD_GLYPH *g, const EPD_FONT *font, uint16_t chr) {
+  uint16_t n = chr - font->First;
+
+  g->Data = font->Data;
+  g->Pos = font->Index[n / EPD_FONT_INDEX_STEP];
+  for (n %= EPD_FONT_INDEX_STEP;; n--) {
+    _epd_glyph_header(g, font);
+    if (n == 0) break;
+    g->Pos += (uint32_t) g->Lines * g->Bits;
+  }
+}
+
+// memory row l of the cell, MSB first; rows have to be read in order
+static uint32_t _epd_glyph_line(EPD_GLYPH *g, uint16_t l) {
+  if (l < g->Line0 || l >= g->Line0 + g->Lines) return 0;
+  return _epd_getbits(g, g->Bits) << (32 - g->Bit0 - g->Bits);
+}
+
+// a font laid out for the current rotation, else any of the same size
+static const EPD_FONT* _epd_font(uint16_t size1) {
+  const EPD_FONT *font, *other = NULL;
+
+  for (font = epd_fonts; font->Size; font++) {
+    if (font->Size != size1) continue;
+    if (font->Rotate == EPD_Paint.Rotate) return font;
+    if (other == NULL) other = font;
+  }
+  return other;
+}
+
+// glyph g, positioned on its box, in its cell at (x, y)
+static void _epd_drawcell(int32_t x, int32_t y, const EPD_FONT *font, EPD_GLYPH *g,
+    uint16_t color, uint8_t opaque) {
+  int32_t X0, Y0;
+  uint16_t l, b, gx, gy;
+  uint32_t row;
+  uint16_t back = EPD_COLOR_BACK(color);
+
+  if (font->Rotate == EPD_Paint.Rotate) {
+    _epd_ops->maprect(x, y, font->Width, font->Height, &X0, &Y0);
+    if (Y0 > EPD_Paint.BandEnd || Y0 + font->Lines <= EPD_Paint.BandStart) return;
+    for (l = 0; l < font->Lines; l++) {
+      _epd_blitline(X0, Y0 + l, font->Bits, _epd_glyph_line(g, l), color, opaque);
+    }
+    return;
+  }
+
+  // glyphs of another rotation go through setpixel
+  for (l = 0; l < font->Lines; l++) {
+    row = _epd_glyph_line(g, l);
+    for (b = 0; b < font->Bits; b++) {
+      if (!opaque && !(row & (0x80000000UL >> b))) continue;
+      _epd_native_xy(font->Rotate, font->Width, font->Height, l, b, &gx, &gy);
+      _epd_ops->setpixel(x + gx, y + gy, (row & (0x80000000UL >> b)) ? color : back);
     }
-    y = y0;
   }
 }
 
+static void _epd_drawglyph(int32_t x, int32_t y, const EPD_FONT *font, uint16_t chr,
+    uint16_t color, uint8_t opaque) {
+  EPD_GLYPH g;
+
+  _epd_glyph_seek(&g, font, chr);
+  _epd_drawcell(x, y, font, &g, color, opaque);
+}
+
+void epd_paint_showChar(uint16_t x, uint16_t y, uint16_t chr, uint16_t size1, uint16_t color) {
+  const EPD_FONT *font = _epd_font(size1);
+
+  if (font == NULL || chr < font->First || chr - font->First >= font->Count) return;
+  _epd_drawglyph(x, y, font, chr, color, 1);
+}
+
 void epd_paint_showString(uint16_t x, uint16_t y, uint8_t *chr, uint16_t size1, uint16_t color) {
   while (*chr != '\0') {
     epd_paint_showChar(x, y, *chr, size1, color);
@@ -622,30 +1877,216 @@ void epd_paint_showString(uint16_t x, uint16_t y, uint8_t *chr, uint16_t size1,
   }
 }
 
-// m^n
-static uint32_t _Pow(uint16_t m, uint16_t n) {
-  uint32_t result = 1;
-  while (n--) {
-    result *= m;
+#define EPD_NUM_MAX 12 // '-', 10 digits, '.'
+
+// stream positions of the digit glyphs of the font the last number was
+// drawn with, so digits skip the index walk of _epd_glyph_seek()
+static const EPD_FONT *_epd_digit_font = NULL;
+static uint32_t _epd_digit_pos[10];
+
+static void _epd_digit_seek(EPD_GLYPH *g, const EPD_FONT *font, uint8_t d) {
+  uint8_t i;
+
+  if (font != _epd_digit_font) {
+    _epd_glyph_seek(g, font, '0');
+    for (i = 0;; i++) {
+      _epd_digit_pos[i] = g->Pos - 2 * (font->LineField + font->BitField);
+      if (i == 9) break;
+      g->Pos += (uint32_t) g->Lines * g->Bits;
+      _epd_glyph_header(g, font);
+    }
+    _epd_digit_font = font;
+  }
+  g->Data = font->Data;
+  g->Pos = _epd_digit_pos[d];
+  _epd_glyph_header(g, font);
+}
+
+// v / 10^decimals written backwards from end in one pass: at least digits
+// digits, a 0 before the dot, '-' in front when neg. Returns the start
+static char* _epd_fixed(char *end, uint32_t v, uint8_t neg, uint8_t decimals, uint8_t digits) {
+  char *p = end;
+  uint8_t n = 0;
+
+  do {
+    *--p = '0' + v % 10;
+    v /= 10;
+    if (++n == decimals) *--p = '.';
+  } while (v || n <= decimals || n < digits);
+  if (neg) *--p = '-';
+  return p;
+}
+
+// characters p..end right aligned in width cells (0: as many as needed),
+// then unit; returns x after the last cell
+static uint16_t _epd_drawnum(uint16_t x, uint16_t y, const EPD_FONT *font, const char *p,
+    const char *end, uint8_t width, const char *unit, uint16_t color) {
+  EPD_GLYPH g;
+  uint8_t c;
+
+  if (width) {
+    // too long: keep the low digits, as the fixed width showNum always did
+    if (end - p > width) p = end - width;
+    for (c = end - p; c < width; c++, x += font->Width) {
+      _epd_drawglyph(x, y, font, ' ', color, 1);
+    }
+  }
+  for (; p < end; p++, x += font->Width) {
+    if (*p >= '0' && *p <= '9') {
+      _epd_digit_seek(&g, font, *p - '0');
+      _epd_drawcell(x, y, font, &g, color, 1);
+    }
+    else {
+      _epd_drawglyph(x, y, font, *p, color, 1);
+    }
   }
-  return result;
+  for (; unit != NULL && *unit; unit++, x += font->Width) {
+    c = *unit;
+    if (c >= font->First && c - font->First < font->Count) {
+      _epd_drawglyph(x, y, font, c, color, 1);
+    }
+  }
+  return x;
 }
 
+// num as exactly len digits, leading zeros included
 void epd_paint_showNum(uint16_t x, uint16_t y, uint32_t num, uint16_t len, uint16_t size1,
     uint16_t color) {
-  uint8_t t, temp, m = 0;
-  if (size1 == 8) m = 2;
-  for (t = 0; t < len; t++) {
-    temp = (num / _Pow(10, len - t - 1)) % 10;
-    if (temp == 0) {
-      epd_paint_showChar(x + (size1 / 2 + m) * t, y, '0', size1, color);
+  char buf[EPD_NUM_MAX];
+  const EPD_FONT *font = _epd_font(size1);
+
+  if (font == NULL || len == 0) return;
+  if (len > 10) len = 10;
+  _epd_drawnum(x, y, font, _epd_fixed(buf + sizeof(buf), num, 0, 0, len), buf + sizeof(buf), len,
+      NULL, color);
+}
+
+uint16_t epd_paint_showFixed(uint16_t x, uint16_t y, int32_t value, uint8_t decimals,
+    uint8_t width, const char *unit, uint16_t size1, uint16_t color) {
+  char buf[EPD_NUM_MAX];
+  const EPD_FONT *font = _epd_font(size1);
+  uint32_t v = value < 0 ? -(uint32_t) value : (uint32_t) value;
+
+  if (font == NULL) return x;
+  if (decimals > 9) decimals = 9;
+  return _epd_drawnum(x, y, font, _epd_fixed(buf + sizeof(buf), v, value < 0, decimals, 1),
+      buf + sizeof(buf), width, unit, color);
+}
+
+// pen advance of c on its own; monospace text keeps the cell width for
+// every code, as showString does
+static int16_t _epd_text_advance(const EPD_FONT *font, uint8_t c, uint8_t flags) {
+  if (!(flags & EPD_TEXT_PROP)) return font->Width;
+  if (c < font->First || c - font->First >= font->Count) return 0;
+  return font->Metrics[2 * (c - font->First) + 1];
+}
+
+// pixels b moves towards a, from the sorted kerning pairs
+static uint8_t _epd_text_kern(const EPD_FONT *font, uint8_t a, uint8_t b, uint8_t flags) {
+  int16_t lo = 0, hi = (int16_t) font->KernCount - 1, mid;
+  uint16_t key = a << 8 | b, k;
+
+  if (!(flags & EPD_TEXT_PROP)) return 0;
+  while (lo <= hi) {
+    mid = (lo + hi) / 2;
+    k = font->Kern[3 * mid] << 8 | font->Kern[3 * mid + 1];
+    if (k == key) return font->Kern[3 * mid + 2];
+    if (k < key) lo = mid + 1;
+    else hi = mid - 1;
+  }
+  return 0;
+}
+
+// one line of text from s: up to '\n' or the end, or with EPD_TEXT_WRAP to
+// the last space before the line gets wider than w (a word wider than w is
+// split). Returns the end of the line, *width gets its width in pixels
+static const char* _epd_text_line(const EPD_FONT *font, const char *s, uint16_t w,
+    uint8_t flags, int16_t *width) {
+  const char *p, *brk = NULL;
+  int16_t pen = 0, end = 0, right, brkw = 0;
+  // proportional advances hold one blank column after the ink
+  int16_t trail = flags & EPD_TEXT_PROP ? 1 : 0;
+
+  for (p = s; *p != '\0' && *p != '\n'; p++) {
+    right = pen + _epd_text_advance(font, *p, flags) - trail;
+    if (right < end) right = end; // codes the font does not have
+    if ((flags & EPD_TEXT_WRAP) && right > w && p > s) {
+      if (brk != NULL) {
+        *width = brkw;
+        return brk;
+      }
+      break;
     }
-    else {
-      epd_paint_showChar(x + (size1 / 2 + m) * t, y, temp + '0', size1, color);
+    if (*p == ' ' && p > s && p[-1] != ' ') {
+      brk = p;
+      brkw = end;
     }
+    end = right;
+    pen += _epd_text_advance(font, *p, flags) - _epd_text_kern(font, p[0], p[1], flags);
   }
+  *width = end > 0 ? end : 0;
+  return p;
 }
 
+// start of the line after the one ending at p
+static const char* _epd_text_next(const char *p) {
+  if (*p == '\n') return p + 1;
+  while (*p == ' ') {
+    p++;
+  }
+  return p;
+}
+
+void epd_paint_measureText(const char *text, uint16_t w, uint16_t size1, uint8_t flags,
+    uint16_t *width, uint16_t *height) {
+  const EPD_FONT *font = _epd_font(size1);
+  const char *p = text, *end;
+  int16_t lw;
+
+  *width = 0;
+  *height = 0;
+  if (font == NULL) return;
+  do {
+    end = _epd_text_line(font, p, w, flags, &lw);
+    if (lw > *width) *width = lw;
+    *height += font->Height;
+    p = _epd_text_next(end);
+  } while (*end != '\0');
+}
+
+uint16_t epd_paint_drawText(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const char *text,
+    uint16_t size1, uint16_t color, uint8_t flags) {
+  const EPD_FONT *font = _epd_font(size1);
+  const char *p = text, *end;
+  int16_t lw, pen, adv, trail = flags & EPD_TEXT_PROP ? 1 : 0;
+  uint16_t used = 0;
+  uint8_t c, left;
+
+  if (font == NULL) return 0;
+  do {
+    if (used + font->Height > h) break;
+    end = _epd_text_line(font, p, w, flags, &lw);
+    pen = 0;
+    if ((flags & EPD_TEXT_ALIGN) == EPD_TEXT_CENTER) pen = ((int16_t) w - lw) / 2;
+    else if ((flags & EPD_TEXT_ALIGN) == EPD_TEXT_RIGHT) pen = (int16_t) w - lw;
+    for (; p < end; p++) {
+      c = *p;
+      adv = _epd_text_advance(font, c, flags);
+      // clipped to the box: only glyphs whose ink is inside are drawn
+      if (pen >= 0 && pen + adv - trail <= w && c >= font->First
+          && c - font->First < font->Count) {
+        left = flags & EPD_TEXT_PROP ? font->Metrics[2 * (c - font->First)] : 0;
+        _epd_drawglyph(x + pen - left, y + used, font, c, color, 0);
+      }
+      pen += adv - _epd_text_kern(font, c, p[1], flags);
+    }
+    used += font->Height;
+    p = _epd_text_next(end);
+  } while (*end != '\0');
+  return used;
+}
+
+#ifdef EPD_FONT_CJK
 void epd_paint_showChinese(uint16_t x, uint16_t y, uint16_t num, uint16_t size1, uint16_t color) {
   uint16_t m, temp;
   uint16_t x0, y0;
@@ -680,6 +2121,8 @@ void epd_paint_showChinese(uint16_t x, uint16_t y, uint16_t num, uint16_t size1,
   }
 }
 
+#endif
+
 void epd_paint_showPicture(uint16_t x, uint16_t y, uint16_t sizex, uint16_t sizey,
     const uint8_t BMP[], uint16_t Color) {
   uint16_t j = 0;
@@ -706,3 +2149,45 @@ void epd_paint_showPicture(uint16_t x, uint16_t y, uint16_t sizex, uint16_t size
     }
   }
 }
+
+// next memory row of an asset: in place, or unpacked into line
+static const uint8_t* _epd_asset_row(const EPD_ASSET *asset, EPD_UNPACK *u, uint8_t *line,
+    uint16_t l) {
+  uint16_t stride = (asset->Bits + 7) / 8;
+
+  if (!asset->Packed) return asset->Data + (uint32_t) l * stride;
+  _epd_unpack(u, line, stride);
+  return line;
+}
+
+// assets converted for the current rotation are copied row by row, others
+// go through setpixel
+void epd_paint_showAsset(uint16_t x, uint16_t y, const EPD_ASSET *asset) {
+  const uint8_t *row;
+  uint8_t line[EPD_W_BUFF_SIZE];
+  EPD_UNPACK u;
+  int32_t X0, Y0;
+  uint16_t l, b, gx, gy;
+
+  if (asset->Packed && (asset->Bits + 7) / 8 > sizeof(line)) return;
+  _epd_unpack_init(&u, asset->Data);
+
+  if (asset->Rotate != EPD_Paint.Rotate) {
+    for (l = 0; l < asset->Lines; l++) {
+      row = _epd_asset_row(asset, &u, line, l);
+      for (b = 0; b < asset->Bits; b++) {
+        _epd_native_xy(asset->Rotate, asset->Width, asset->Height, l, b, &gx, &gy);
+        _epd_ops->setpixel(x + gx, y + gy,
+            (row[b / 8] & (0x80 >> (b % 8))) ? EPD_COLOR_WHITE : EPD_COLOR_BLACK);
+      }
+    }
+    return;
+  }
+
+  _epd_ops->maprect(x, y, asset->Width, asset->Height, &X0, &Y0);
+  if (Y0 > EPD_Paint.BandEnd || Y0 + asset->Lines <= EPD_Paint.BandStart) return;
+  for (l = 0; l < asset->Lines; l++) {
+    row = _epd_asset_row(asset, &u, line, l);
+    _epd_copyrow(X0, Y0 + l, row, asset->Bits);
+  }
+}
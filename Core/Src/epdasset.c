@@ -0,0 +1,669 @@
+/*
+ * epdasset.c
+ *
+ * Generated by Tools/imgconv.py, do not edit.
+ * Rotation: 0
+ * image1: Core/Inc/bmp.h:gImage_1:250x122
+ * image2: Core/Inc/bmp.h:gImage_2:250x122
+ * image3: Core/Inc/bmp.h:gImage_3:250x122
+ * image4: Core/Inc/bmp.h:gImage_4:250x122
+ */
+
+#include "epdasset.h"
+
+static const uint8_t epd_asset_image1_data[] = {
+  0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0,
+  0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0,
+  0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0,
+  0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0,
+  0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0,
+  0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF7, 0xFF, 0x05, 0xFE,
+  0x3F, 0xFC, 0xFF, 0xFF, 0xC0, 0xF7, 0xFF, 0x05, 0xFE, 0x1F, 0xFC, 0x7F, 0xFF, 0xC0, 0xF7, 0xFF,
+  0x05, 0xFE, 0x07, 0xFC, 0x7F, 0xFF, 0xC0, 0xF8, 0xFF, 0x06, 0xBF, 0xFE, 0x03, 0xFE, 0x3F, 0xFF,
+  0xC0, 0xF9, 0xFF, 0x07, 0xE0, 0x3F, 0xFE, 0x01, 0xFE, 0x3F, 0xFF, 0xC0, 0xFA, 0xFF, 0x08, 0xF8,
+  0x00, 0x3F, 0xFE, 0x30, 0x7E, 0x3F, 0xFF, 0xC0, 0xFB, 0xFF, 0x09, 0xFE, 0x00, 0x00, 0x3F, 0xFE,
+  0x38, 0x08, 0x3F, 0xFF, 0xC0, 0xFB, 0xFF, 0x09, 0xC0, 0x00, 0x03, 0xFF, 0xFE, 0x3C, 0x00, 0x7F,
+  0xFF, 0xC0, 0xFC, 0xFF, 0x0A, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x3F, 0x00, 0x7F, 0xFF, 0xC0,
+  0xFC, 0xFF, 0x0A, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xE3, 0xFF, 0xFF, 0xC0, 0xFC, 0xFF,
+  0x01, 0xFC, 0x01, 0xF9, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x02, 0xFC, 0x00, 0x0F, 0xFE, 0xFF, 0x00,
+  0x3F, 0xFE, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x05, 0x80, 0x00, 0x7F, 0xFF, 0xFE, 0x3F, 0xFE, 0xFF,
+  0x00, 0xC0, 0xFB, 0xFF, 0x05, 0xFC, 0x00, 0x01, 0xFF, 0xFE, 0x3F, 0xFE, 0xFF, 0x00, 0xC0, 0xFA,
+  0xFF, 0x04, 0xE0, 0x00, 0x3F, 0xFE, 0x3F, 0xFE, 0xFF, 0x00, 0xC0, 0xF9, 0xFF, 0x01, 0x00, 0x3F,
+  0xFC, 0xFF, 0x00, 0xC0, 0xF9, 0xFF, 0x07, 0x00, 0x3F, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xC0, 0xFA,
+  0xFF, 0x08, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xC0, 0xFB, 0xFF, 0x02, 0xFC, 0x00,
+  0x01, 0xFE, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0xC0, 0xFB, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFE, 0xFF,
+  0x03, 0xF8, 0x7F, 0xFF, 0xC0, 0xFC, 0xFF, 0x0A, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
+  0x7F, 0xFF, 0xC0, 0xFC, 0xFF, 0x01, 0xFC, 0x01, 0xFE, 0xFF, 0x05, 0xFE, 0x00, 0x00, 0x7F, 0xFF,
+  0xC0, 0xFC, 0xFF, 0x0A, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0xFC,
+  0xFF, 0x02, 0xFC, 0x00, 0x01, 0xFA, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x02, 0xC0, 0x00, 0x07, 0xFB,
+  0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0xFF, 0x00, 0xC0, 0xFA, 0xFF,
+  0x08, 0xF8, 0x00, 0x3F, 0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 0xC0, 0xF9, 0xFF, 0x07, 0xE0, 0x3F, 0xFF,
+  0x1F, 0xFC, 0x7F, 0xFF, 0xC0, 0xF8, 0xFF, 0x06, 0x3F, 0xFE, 0x3F, 0x7C, 0x3F, 0xFF, 0xC0, 0xF7,
+  0xFF, 0x05, 0xFE, 0x3F, 0x3E, 0x3F, 0xFF, 0xC0, 0xF7, 0xFF, 0x05, 0xFE, 0x7F, 0x3E, 0x3F, 0xFF,
+  0xC0, 0xFB, 0xFF, 0x09, 0xFC, 0x0F, 0xFF, 0xFF, 0xFE, 0x3E, 0x1E, 0x3F, 0xFF, 0xC0, 0xFB, 0xFF,
+  0x09, 0xC0, 0x00, 0xFF, 0xFF, 0xFE, 0x0C, 0x00, 0x3F, 0xFF, 0xC0, 0xFB, 0xFF, 0xFF, 0x00, 0x07,
+  0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0xFC, 0xFF, 0x0A, 0xFE, 0x00, 0x00, 0x1F, 0xFF,
+  0xFF, 0x80, 0xC0, 0xFF, 0xFF, 0xC0, 0xFC, 0xFF, 0x06, 0xFE, 0x0F, 0x1C, 0x0F, 0xFF, 0xFF, 0xE1,
+  0xFE, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xFC, 0x3F, 0x1F, 0x0F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC,
+  0xFF, 0x03, 0xFC, 0x3F, 0x1F, 0x8F, 0xFE, 0xFF, 0x03, 0xF9, 0xFF, 0xFF, 0xC0, 0xFC, 0xFF, 0x03,
+  0xFC, 0x7F, 0x1F, 0x8F, 0xFE, 0xFF, 0x03, 0xF8, 0x1F, 0xFF, 0xC0, 0xFC, 0xFF, 0x03, 0xFC, 0x7F,
+  0x1F, 0x8F, 0xFE, 0xFF, 0x03, 0xF8, 0x1F, 0xFF, 0xC0, 0xFC, 0xFF, 0x03, 0xFC, 0x7F, 0x1F, 0x8F,
+  0xFE, 0xFF, 0x03, 0xFC, 0x1F, 0xFF, 0xC0, 0xFC, 0xFF, 0x03, 0xFC, 0x3F, 0x1E, 0x0F, 0xFB, 0xFF,
+  0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xFE, 0x3F, 0x10, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03,
+  0xFE, 0x1F, 0x00, 0x1F, 0xFE, 0xFF, 0x03, 0xF9, 0xFF, 0xFF, 0xC0, 0xFB, 0xFF, 0x02, 0x3F, 0x00,
+  0x7F, 0xFE, 0xFF, 0x03, 0xF8, 0x1F, 0xFF, 0xC0, 0xFA, 0xFF, 0x00, 0x01, 0xFD, 0xFF, 0x06, 0xF8,
+  0x1F, 0xFF, 0xC0, 0xFF, 0xFF, 0xFE, 0xF8, 0xFF, 0x07, 0xFC, 0x1F, 0xFF, 0xC0, 0xFF, 0xFF, 0xFC,
+  0x7F, 0xF6, 0xFF, 0x07, 0xC0, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x7F, 0xF9, 0xFF, 0x07, 0xC0,
+  0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x07, 0xF9, 0xFF, 0x08, 0xC0, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
+  0xFC, 0x00, 0x7F, 0xFA, 0xFF, 0x08, 0xC0, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x0F, 0xFA,
+  0xFF, 0x08, 0xC0, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xFA, 0xFF, 0x00, 0xC0, 0xFB,
+  0xFF, 0x02, 0xFC, 0x00, 0x0F, 0xFB, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x02, 0xFC, 0x40, 0x01, 0xFB,
+  0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x03, 0xFC, 0x7C, 0x00, 0x3F, 0xFC, 0xFF, 0x3B, 0xC0, 0xFF, 0x87,
+  0xFF, 0x3F, 0xFF, 0xFF, 0xFC, 0x7F, 0xC0, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0x83,
+  0xFF, 0x1F, 0xFF, 0xFF, 0xFC, 0x7F, 0xE0, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0x81,
+  0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x7E, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0x80,
+  0x7F, 0x8F, 0xFF, 0xFF, 0xFC, 0x70, 0x00, 0x7F, 0xFE, 0xFE, 0x3F, 0x0C, 0xFF, 0xC0, 0xFF, 0x88,
+  0x3F, 0x8F, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFE, 0xFE, 0x3F, 0x0C, 0xFF, 0xC0, 0xFF, 0x8C,
+  0x0F, 0x8F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFE, 0xFE, 0x3F, 0x0C, 0xFF, 0xC0, 0xFF, 0x8F,
+  0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0xFE, 0x3F, 0x0C, 0xFF, 0xC0, 0xFF, 0x8F,
+  0x80, 0x1F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0xFE, 0x3F, 0x08, 0xFF, 0xC0, 0xFF, 0x8F,
+  0xE0, 0x3F, 0xFF, 0xFC, 0x03, 0xFE, 0xFF, 0x05, 0xFE, 0x3F, 0xFF, 0x3F, 0xFF, 0xC0, 0xFC, 0xFF,
+  0x01, 0xFC, 0x1F, 0xF9, 0xFF, 0x04, 0xC0, 0xFF, 0x8F, 0xFF, 0x3F, 0xF6, 0xFF, 0x04, 0xC0, 0xFF,
+  0x87, 0xFF, 0x1F, 0xF6, 0xFF, 0x04, 0xC0, 0xFF, 0x81, 0xFF, 0x1F, 0xFB, 0xFF, 0x75, 0xC0, 0x00,
+  0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0x80, 0xFF, 0x8F, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xC0, 0x00,
+  0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0x80, 0x7F, 0x8F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xC0, 0x00,
+  0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0x8C, 0x1F, 0x8F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x3F,
+  0xE3, 0xFF, 0xFF, 0xC0, 0xFF, 0x8E, 0x02, 0x0F, 0xFF, 0xFE, 0x03, 0xF0, 0x1F, 0xFF, 0xFE, 0x3F,
+  0xF3, 0xFF, 0xFF, 0xC0, 0xFF, 0x8F, 0x00, 0x1F, 0xFF, 0xFC, 0x1F, 0xFE, 0x0F, 0xFF, 0xFE, 0x3F,
+  0xF3, 0xFF, 0xFF, 0xC0, 0xFF, 0x8F, 0xC0, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF, 0x0F, 0xFF, 0xFE, 0x1F,
+  0xC3, 0xFF, 0xFF, 0xC0, 0xFF, 0x8F, 0xF8, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0x8F, 0xFF, 0xFF, 0x00,
+  0x03, 0xFF, 0xFF, 0xC0, 0xFC, 0xFF, 0x0A, 0xFC, 0x7F, 0xFF, 0x8F, 0xFF, 0xFF, 0x00, 0x07, 0xFF,
+  0xFF, 0xC0, 0xFC, 0xFF, 0x0A, 0xFC, 0x7F, 0xFF, 0x8F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xC0,
+  0xFC, 0xFF, 0x03, 0xFC, 0x3F, 0xFF, 0x0F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x06, 0xFC, 0x1F,
+  0xFF, 0x0F, 0xFF, 0xFF, 0xC7, 0xFE, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x0A, 0xFE, 0x1F, 0xFF, 0x1F,
+  0xFF, 0xFF, 0x01, 0xE7, 0xFF, 0xFF, 0xC0, 0xFB, 0xFF, 0x09, 0x3F, 0xFF, 0xBF, 0xFF, 0xFE, 0x00,
+  0xE3, 0xFF, 0xFF, 0xC0, 0xF7, 0xFF, 0x08, 0xFE, 0x10, 0xE3, 0xFF, 0xFF, 0xC0, 0xFF, 0x9F, 0xFE,
+  0xFC, 0xFF, 0x0A, 0x8F, 0xFF, 0xFE, 0x3C, 0xF3, 0xFF, 0xFF, 0xC0, 0xFF, 0x87, 0xF8, 0xFC, 0xFF,
+  0x0A, 0x8F, 0xFF, 0xFE, 0x3C, 0xF3, 0xFF, 0xFF, 0xC0, 0xFF, 0x81, 0xE0, 0xFC, 0xFF, 0x0A, 0x8F,
+  0xFF, 0xFE, 0x1C, 0xE3, 0xFF, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0xFE, 0xFF, 0xFE, 0x00, 0x0C, 0x7F,
+  0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFE, 0xFE, 0x00, 0x0C, 0x7F,
+  0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFC, 0xFE, 0x00, 0x12, 0x7F,
+  0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0x8F, 0xFF,
+  0xFE, 0x7F, 0xFE, 0xFF, 0x09, 0xC0, 0xFF, 0xC0, 0x40, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0x8F, 0xFB,
+  0xFF, 0x09, 0xC0, 0xFF, 0x81, 0xE0, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0x8F, 0xFB, 0xFF, 0x09, 0xC0,
+  0xFF, 0x87, 0xF8, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0x8F, 0xFB, 0xFF, 0x02, 0xC0, 0xFF, 0x9F, 0xFE,
+  0xFF, 0x01, 0xFC, 0x3F, 0xFE, 0xFF, 0x05, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFC, 0xFF, 0x01,
+  0xFE, 0x7F, 0xFE, 0xFF, 0x05, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xF7, 0xFF, 0x05, 0xFE, 0x1F,
+  0xC3, 0xFF, 0xFF, 0xC0, 0xF7, 0xFF, 0x05, 0xFE, 0x3F, 0xE3, 0xFF, 0xFF, 0xC0, 0xF7, 0xFF, 0x05,
+  0xFE, 0x7F, 0xF3, 0xFF, 0xFF, 0xC0, 0xF7, 0xFF, 0x05, 0xFE, 0x3F, 0xE3, 0xFF, 0xFF, 0xC0, 0xF7,
+  0xFF, 0x09, 0xFE, 0x0F, 0x83, 0xFF, 0xFF, 0xC0, 0xFF, 0x8F, 0xFF, 0x3F, 0xFA, 0xFF, 0x08, 0x00,
+  0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0x87, 0xFF, 0x1F, 0xFA, 0xFF, 0x08, 0x80, 0x07, 0xFF, 0xFF, 0xC0,
+  0xFF, 0x81, 0xFF, 0x1F, 0xFA, 0xFF, 0x08, 0xE0, 0x3F, 0xFF, 0xFF, 0xC0, 0xFF, 0x80, 0xFF, 0x8F,
+  0xF6, 0xFF, 0x04, 0xC0, 0xFF, 0x80, 0x7F, 0x8F, 0xFA, 0xFF, 0x00, 0xF8, 0xFE, 0xFF, 0x07, 0xC0,
+  0xFF, 0x8C, 0x1F, 0x8F, 0xFF, 0xFF, 0x9F, 0xFD, 0xFF, 0x44, 0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF,
+  0x8E, 0x02, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0x03, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0xFF,
+  0x8F, 0x00, 0x1F, 0xFF, 0xFE, 0x0F, 0xFE, 0x00, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF,
+  0x8F, 0xC0, 0x1F, 0xFF, 0xFE, 0x1F, 0xFC, 0x00, 0x7F, 0xFE, 0x3C, 0xE3, 0xFF, 0xFF, 0xC0, 0xFF,
+  0x8F, 0xF8, 0xFF, 0xFF, 0xFC, 0x3F, 0xF8, 0x00, 0x3F, 0xFE, 0x3C, 0xF3, 0xFF, 0xFF, 0xC0, 0xFC,
+  0xFF, 0x0C, 0xFC, 0x3F, 0xF0, 0x7C, 0x3F, 0xFE, 0x3C, 0xE3, 0xFF, 0xFF, 0xC0, 0xFF, 0xC7, 0xFE,
+  0xFF, 0x44, 0xFC, 0x7F, 0xF0, 0xFE, 0x3F, 0xFE, 0x3C, 0xC3, 0xFF, 0xFF, 0xC0, 0xFF, 0xC7, 0xC0,
+  0x1F, 0xFF, 0xFC, 0x7F, 0xE1, 0xFE, 0x3F, 0xFE, 0x1C, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0x87, 0xC0,
+  0x1F, 0xFF, 0xFC, 0x7F, 0xE1, 0xFE, 0x3F, 0xFF, 0x1C, 0x07, 0xFF, 0xFF, 0xC0, 0xFF, 0x8F, 0xC0,
+  0x1F, 0xFF, 0xFC, 0x3F, 0xE1, 0xFE, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xC0, 0xFF, 0x9F, 0xE7,
+  0x9F, 0xFF, 0xFC, 0x3F, 0xC3, 0xFE, 0x3F, 0xFC, 0xFF, 0x0A, 0xC0, 0xFF, 0x8F, 0xE7, 0x9F, 0xFF,
+  0xFE, 0x1F, 0x83, 0xFC, 0x3F, 0xFC, 0xFF, 0x38, 0xC0, 0xFF, 0x87, 0xC7, 0x9F, 0xFF, 0xFE, 0x00,
+  0x07, 0xF8, 0x3F, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xC0, 0x07, 0x9F, 0xFF, 0xFF, 0x00,
+  0x0F, 0xF8, 0x7F, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xC0, 0x0F, 0x8F, 0xFF, 0xFF, 0x80,
+  0x1F, 0xFC, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xF0, 0x1F, 0xCF, 0xFF, 0xFF, 0xE0,
+  0x7F, 0xFD, 0xFF, 0x03, 0x83, 0xFF, 0xFF, 0xC0, 0xF5, 0xFF, 0x03, 0xE3, 0xFF, 0xFF, 0xC0, 0xF5,
+  0xFF, 0x06, 0xF3, 0xFF, 0xFF, 0xC0, 0xFF, 0xF8, 0x00, 0xFC, 0xFF, 0x00, 0x8F, 0xFE, 0xFF, 0x07,
+  0xF3, 0xFF, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x3F, 0xFD, 0xFF, 0x00, 0x8F, 0xFB, 0xFF, 0x0A, 0xC0,
+  0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x06, 0xC0, 0xFF, 0x83,
+  0xFE, 0x0F, 0xFF, 0xFE, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x06, 0xC0, 0xFF, 0x8F, 0xFF, 0x8F,
+  0xFF, 0xFE, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x06, 0xC0, 0xFF, 0x8F, 0xFF, 0x8F, 0xFF, 0xFC,
+  0xFE, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x09, 0xC0, 0xFF, 0x87, 0xFF, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF,
+  0x8F, 0xFB, 0xFF, 0x09, 0xC0, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFC, 0x7F, 0xFF, 0x8F, 0xFB, 0xFF,
+  0x09, 0xC0, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFC, 0x7F, 0xFF, 0x8F, 0xFB, 0xFF, 0x10, 0xC0, 0xFF,
+  0xF0, 0x00, 0x7F, 0xFF, 0xFC, 0x3F, 0xFF, 0x8F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0xFC,
+  0xFF, 0x01, 0xFE, 0x3F, 0xFE, 0xFF, 0x05, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xFC, 0xFF, 0x00,
+  0xFE, 0xFD, 0xFF, 0x05, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xF5, 0xFF, 0x03, 0xC0, 0x3F, 0xFF,
+  0xC0, 0xF6, 0xFF, 0x04, 0xFC, 0x00, 0x3F, 0xFF, 0xC0, 0xFB, 0xFF, 0x09, 0xC0, 0x00, 0x0F, 0xFF,
+  0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0xFB, 0xFF, 0xFF, 0x00, 0x07, 0x0F, 0xFF, 0xFF, 0x80, 0x3F,
+  0xFF, 0xFF, 0xC0, 0xFC, 0xFF, 0x0A, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF,
+  0xC0, 0xFC, 0xFF, 0x0A, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xC0, 0xFC,
+  0xFF, 0x01, 0xFC, 0x3F, 0xFD, 0xFF, 0x04, 0xF8, 0x00, 0x7F, 0xFF, 0xC0, 0xFC, 0xFF, 0x01, 0xFC,
+  0x7F, 0xFC, 0xFF, 0x0A, 0x80, 0x3F, 0xFF, 0xC0, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFC, 0x7F, 0xFD,
+  0xFF, 0x0B, 0xE0, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFC, 0x3F, 0xFE, 0xFF,
+  0x0C, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFC, 0x3F, 0xFE, 0xFF,
+  0x0C, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0xFF, 0x8F, 0xCF, 0xCF, 0xFF, 0xFE, 0x0F, 0xFE, 0xFF,
+  0x01, 0xFE, 0x3F, 0xFE, 0xFF, 0x09, 0xC0, 0xFF, 0x8F, 0xCF, 0xCF, 0xFF, 0xFC, 0x00, 0x00, 0x0F,
+  0xFB, 0xFF, 0x09, 0xC0, 0xFF, 0x8F, 0xCF, 0xCF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFB, 0xFF, 0x24,
+  0xC0, 0xFF, 0x8F, 0xCF, 0xCF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF,
+  0xC0, 0xFF, 0x8F, 0xCF, 0xCF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF,
+  0xC0, 0xFF, 0x8F, 0xFF, 0xCF, 0xFA, 0xFF, 0x04, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xF7, 0xFF, 0x08,
+  0xFE, 0x1F, 0xC3, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0x9F, 0xFA, 0xFF, 0x08, 0xFE, 0x3F, 0xE3, 0xFF,
+  0xFF, 0xC0, 0xFF, 0xFF, 0x9F, 0xFA, 0xFF, 0x08, 0xFE, 0x3F, 0xF3, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
+  0x9F, 0xFA, 0xFF, 0x08, 0xFE, 0x3F, 0xE3, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0x9F, 0xFE, 0xFF, 0x0C,
+  0xC0, 0x00, 0xFF, 0xFF, 0xFE, 0x07, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0x9F, 0xFE, 0xFF, 0xFF,
+  0x00, 0x27, 0x3F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFE,
+  0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFE,
+  0x07, 0xF8, 0x1F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xC0, 0xFC, 0xFF, 0x03, 0xFC, 0x1F, 0xFE,
+  0x0F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x06, 0xFC, 0x3F, 0xFF, 0x0F, 0xFF, 0xFF, 0xF8, 0xFE,
+  0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x3C, 0xFC, 0x7F, 0xFF, 0x8F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF,
+  0xC0, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFC, 0x7F, 0xFF, 0x8F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF,
+  0xC0, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0x8F, 0xFF, 0xFE, 0x02, 0x03, 0xFF, 0xFF,
+  0xC0, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFE, 0x1F, 0xFF, 0x0F, 0xFF, 0xFE, 0x3F, 0xE3, 0xFF, 0xFF,
+  0xC0, 0xFF, 0x8F, 0xFE, 0xFF, 0x0C, 0xFE, 0x0F, 0xFC, 0x1F, 0xFF, 0xFE, 0x3F, 0xF3, 0xFF, 0xFF,
+  0xC0, 0xFF, 0x8F, 0xFE, 0xFF, 0x00, 0xFC, 0xFE, 0x00, 0x08, 0x0F, 0xFE, 0x3F, 0xE3, 0xFF, 0xFF,
+  0xC0, 0xFF, 0x8F, 0xFE, 0xFF, 0x00, 0xFC, 0xFE, 0x00, 0x08, 0x0F, 0xFE, 0x1F, 0xC3, 0xFF, 0xFF,
+  0xC0, 0xFF, 0x8F, 0xFE, 0xFF, 0x00, 0xFC, 0xFE, 0x00, 0x08, 0x0F, 0xFE, 0x00, 0x00, 0x1F, 0xFF,
+  0xC0, 0xFF, 0x8F, 0xF9, 0xFF, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0xFF, 0x8F, 0xF9, 0xFF,
+  0x05, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x04, 0xC0, 0xFF,
+  0x80, 0x00, 0x0F, 0xF6, 0xFF, 0x04, 0xC0, 0xFF, 0x80, 0x00, 0x0F, 0xFA, 0xFF, 0x14, 0x80, 0x03,
+  0xFF, 0xFF, 0xC0, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0x0F, 0xFF, 0x00, 0x03,
+  0xFF, 0xFF, 0xC0, 0xFC, 0xFF, 0x0A, 0xFC, 0x00, 0x00, 0x0F, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
+  0xC0, 0xFC, 0xFF, 0x06, 0xFC, 0x00, 0x00, 0x0F, 0x07, 0xFE, 0x3F, 0xFE, 0xFF, 0x00, 0xC0, 0xFC,
+  0xFF, 0x06, 0xFC, 0x00, 0x00, 0x0F, 0x8F, 0xFE, 0x7F, 0xFE, 0xFF, 0x00, 0xC0, 0xF7, 0xFF, 0x01,
+  0xFE, 0x3F, 0xFE, 0xFF, 0x04, 0xC0, 0xFF, 0x80, 0x00, 0x0F, 0xFA, 0xFF, 0x00, 0x0F, 0xFE, 0xFF,
+  0x04, 0xC0, 0xFF, 0x80, 0x00, 0x0F, 0xFB, 0xFF, 0x09, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF,
+  0x80, 0x00, 0x0F, 0xFB, 0xFF, 0x09, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xE0, 0x1F,
+  0xFB, 0xFF, 0x08, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0x00, 0xFE, 0xFF, 0x01, 0xE0,
+  0x01, 0xFA, 0xFF, 0x03, 0xC0, 0xFF, 0xFC, 0x03, 0xFE, 0xFF, 0x02, 0x80, 0x00, 0x7F, 0xFB, 0xFF,
+  0x03, 0xC0, 0xFF, 0xE0, 0x0F, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFB, 0xFF, 0x3C, 0xC0, 0xFF,
+  0x80, 0x7F, 0xFF, 0xFF, 0xFE, 0x07, 0xF8, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0xFF,
+  0x80, 0x00, 0x0F, 0xFF, 0xFC, 0x1F, 0xFE, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0xFF,
+  0x80, 0x00, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0xFF,
+  0x80, 0x00, 0x0F, 0xFF, 0xFC, 0x7F, 0xFF, 0x8F, 0xFF, 0xFE, 0x7F, 0xFE, 0xFF, 0x00, 0xC0, 0xFC,
+  0xFF, 0x06, 0xFC, 0x7F, 0xFF, 0x8F, 0xFF, 0xFE, 0x7F, 0xFE, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03,
+  0xFC, 0x7F, 0xFF, 0x8F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x3D, 0xFC, 0x3F, 0xFF, 0x0F, 0xFF,
+  0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xC0, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFE, 0x1F, 0xFE, 0x0F, 0xFF,
+  0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x40, 0x1F, 0xFF,
+  0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF,
+  0xFE, 0x0C, 0x83, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0x03, 0xFE, 0xFF, 0x0C, 0x80, 0x00, 0x7F, 0xFF,
+  0xFE, 0x3C, 0xE3, 0xFF, 0xFF, 0xC0, 0xFF, 0xFE, 0x01, 0xFE, 0xFF, 0x0D, 0xF0, 0x03, 0xFF, 0xFF,
+  0xFE, 0x3C, 0xF3, 0xFF, 0xFF, 0xC0, 0xFF, 0xF8, 0x00, 0x7F, 0xFB, 0xFF, 0x09, 0xFE, 0x3C, 0xE3,
+  0xFF, 0xFF, 0xC0, 0xFF, 0xF0, 0x38, 0x3F, 0xFB, 0xFF, 0x09, 0xFE, 0x3C, 0x83, 0xFF, 0xFF, 0xC0,
+  0xFF, 0xC0, 0xFC, 0x1F, 0xFA, 0xFF, 0x08, 0x1C, 0x07, 0xFF, 0xFF, 0xC0, 0xFF, 0x81, 0xFF, 0x0F,
+  0xFA, 0xFF, 0x08, 0x1C, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0x87, 0xFF, 0x8F, 0xFA, 0xFF, 0x08, 0xFC,
+  0x7F, 0xFF, 0xFF, 0xC0, 0xFF, 0x8F, 0xFF, 0xCF, 0xF6, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0,
+  0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0,
+  0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0,
+  0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0,
+  0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0,
+  0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0,
+};
+
+const EPD_ASSET epd_asset_image1 = { 250, 122, 0, 250, 122, 2864, epd_asset_image1_data };
+
+static const uint8_t epd_asset_image2_data[] = {
+  0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0,
+  0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0,
+  0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0,
+  0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF9, 0xFF, 0x01, 0xE0, 0x7F, 0xFC, 0xFF, 0x00,
+  0xC0, 0xFA, 0xFF, 0x02, 0xF0, 0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x03, 0xFC, 0x00,
+  0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0xFF,
+  0x00, 0xC0, 0xFC, 0xFF, 0x00, 0xF0, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF,
+  0x00, 0xF0, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00, 0xF0, 0xFE, 0x00,
+  0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x02, 0xF0, 0x00, 0x00, 0xFA, 0xFF, 0x00, 0xC0,
+  0xFC, 0xFF, 0x01, 0xF0, 0x00, 0xF9, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x02, 0xF0, 0x00, 0x0F, 0xFA,
+  0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF,
+  0x00, 0xF0, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00, 0xFC, 0xFE, 0x00,
+  0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x00,
+  0xC0, 0xFA, 0xFF, 0x02, 0xE0, 0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFA, 0xFF, 0x02, 0x80, 0x00,
+  0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x03, 0xC0, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0,
+  0xFC, 0xFF, 0x00, 0xF0, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00, 0xF0,
+  0xFE, 0x00, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00,
+  0xC0, 0xFC, 0xFF, 0x02, 0xF0, 0x00, 0x1F, 0xFA, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x02, 0xF0, 0x00,
+  0x7F, 0xFA, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0xFB, 0xFF, 0x00, 0xC0,
+  0xFC, 0xFF, 0x00, 0xF0, 0xFE, 0x00, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00, 0xF0, 0xFE, 0x00,
+  0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00, 0xF0, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0xFF,
+  0x00, 0xC0, 0xFB, 0xFF, 0x03, 0x80, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x03,
+  0xFE, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFA, 0xFF, 0x02, 0xFC, 0x00, 0x7F, 0xFC, 0xFF,
+  0x00, 0xC0, 0xF9, 0xFF, 0x01, 0xF0, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xFB,
+  0xFF, 0x01, 0xF8, 0x7F, 0xFA, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x01, 0x80, 0x03, 0xFA, 0xFF, 0x00,
+  0xC0, 0xFC, 0xFF, 0x02, 0xFE, 0x00, 0x01, 0xFA, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xFC, 0x00,
+  0x00, 0x7F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0xFB, 0xFF, 0x00,
+  0xC0, 0xFC, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0,
+  0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x08, 0x20, 0x1F, 0xFB, 0xFF,
+  0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x38, 0x38, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03,
+  0xF0, 0x78, 0x3C, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x78, 0x3C, 0x1F, 0xFB,
+  0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x78, 0x38, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF,
+  0x03, 0xF0, 0x78, 0x00, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x38, 0x00, 0x3F,
+  0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x18, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC,
+  0xFF, 0x03, 0xF8, 0x18, 0x00, 0x7F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x02, 0xF8, 0x38, 0x00,
+  0xFA, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x02, 0xFC, 0x78, 0x01, 0xFA, 0xFF, 0x00, 0xC0, 0xFB, 0xFF,
+  0x01, 0xF8, 0x0F, 0xFA, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00, 0xF3, 0xF8, 0xFF, 0x00, 0xC0, 0xFC,
+  0xFF, 0x01, 0xF0, 0x7F, 0xF9, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x01, 0xF0, 0x07, 0xF9, 0xFF, 0x00,
+  0xC0, 0xFC, 0xFF, 0x02, 0xF0, 0x00, 0x7F, 0xFA, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x02, 0xF0, 0x00,
+  0x0F, 0xFA, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x02, 0xF0, 0x00, 0x00, 0xFA, 0xFF, 0x00, 0xC0, 0xFC,
+  0xFF, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF8, 0x00, 0x00,
+  0x01, 0xFB, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x03, 0x80, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0,
+  0xFB, 0xFF, 0x03, 0xC0, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x03, 0xC0, 0xE0,
+  0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x03, 0xC0, 0xFE, 0x00, 0x7F, 0xFC, 0xFF, 0x00,
+  0xC0, 0xFB, 0xFF, 0x03, 0xC0, 0xF8, 0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x03, 0xC0,
+  0x80, 0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x03, 0xC0, 0x00, 0x00, 0x7F, 0xFC, 0xFF,
+  0x00, 0xC0, 0xFB, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0,
+  0x00, 0x00, 0x03, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xFB, 0xFF,
+  0x00, 0xC0, 0xFC, 0xFF, 0x02, 0xF0, 0x00, 0x01, 0xFA, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x02, 0xF0,
+  0x00, 0x1F, 0xFA, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x01, 0xF0, 0x00, 0xF9, 0xFF, 0x00, 0xC0, 0xFC,
+  0xFF, 0x01, 0xF0, 0x0F, 0xF9, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00, 0xF0, 0xF8, 0xFF, 0x00, 0xC0,
+  0xF2, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x01, 0xC0, 0x0F, 0xFA, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x01,
+  0x00, 0x03, 0xFA, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x02, 0xFE, 0x00, 0x00, 0xFA, 0xFF, 0x00, 0xC0,
+  0xFC, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF8, 0x00,
+  0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00,
+  0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0,
+  0x1F, 0xE0, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x3F, 0xF8, 0x1F, 0xFB, 0xFF,
+  0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x7F, 0xF8, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03,
+  0xF0, 0x7F, 0xF8, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x3F, 0xF8, 0x1F, 0xFB,
+  0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x3F, 0xF0, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF,
+  0x03, 0xF0, 0x1F, 0xF0, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF8, 0x3F, 0xF0, 0x3F,
+  0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF8, 0x7F, 0xFC, 0x7F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC,
+  0xFF, 0x02, 0xFD, 0xFF, 0xFE, 0xFA, 0xFF, 0x00, 0xC0, 0xFA, 0xFF, 0x01, 0xF8, 0x3F, 0xFB, 0xFF,
+  0x00, 0xC0, 0xFA, 0xFF, 0x01, 0xF8, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0xFF, 0x00, 0x00,
+  0x01, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFB, 0xFF, 0x00, 0xC0,
+  0xFC, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00,
+  0x00, 0x01, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFB, 0xFF, 0x00,
+  0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0,
+  0x00, 0x00, 0x01, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x3F, 0xF8, 0x3F, 0xFB, 0xFF,
+  0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x7F, 0xF8, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03,
+  0xF0, 0x3F, 0xF8, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x3F, 0xF8, 0x3F, 0xFB,
+  0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00, 0xF8, 0xF8, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00, 0xF9, 0xF8,
+  0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2,
+  0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2,
+  0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x01, 0xFE, 0x3F, 0xF9, 0xFF, 0x00, 0xC0,
+  0xFC, 0xFF, 0x03, 0xFC, 0x1F, 0xF8, 0x07, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF8, 0x0F,
+  0xE0, 0x03, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF8, 0x0F, 0xC0, 0x01, 0xFB, 0xFF, 0x00,
+  0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x1F, 0xC0, 0x00, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0,
+  0x3F, 0x80, 0x00, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x04, 0xF0, 0x3F, 0x80, 0x00, 0x7F, 0xFC,
+  0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x04, 0xF0, 0x3F, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC,
+  0xFF, 0x04, 0xF0, 0x7F, 0x00, 0xE0, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x04, 0xF0, 0x7F,
+  0x01, 0xE0, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x04, 0xF0, 0x3E, 0x01, 0xF0, 0x7F, 0xFC,
+  0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x04, 0xF0, 0x3C, 0x03, 0xF0, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC,
+  0xFF, 0x04, 0xF0, 0x00, 0x03, 0xE0, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x04, 0xF0, 0x00,
+  0x07, 0xE0, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x04, 0xF8, 0x00, 0x07, 0xC0, 0x7F, 0xFC,
+  0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF8, 0x00, 0x0F, 0x80, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF,
+  0x03, 0xFC, 0x00, 0x0F, 0xC0, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xFE, 0x00, 0x1F, 0xE1,
+  0xFB, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x02, 0x00, 0x3F, 0xF3, 0xFB, 0xFF, 0x00, 0xC0, 0xFB, 0xFF,
+  0x00, 0xE3, 0xF9, 0xFF, 0x00, 0xC0, 0xFA, 0xFF, 0x01, 0xF8, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFA,
+  0xFF, 0x01, 0xF8, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFA, 0xFF, 0x01, 0xF8, 0x3F, 0xFB, 0xFF, 0x00,
+  0xC0, 0xFC, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xFC,
+  0x00, 0x00, 0x01, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFB, 0xFF,
+  0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03,
+  0xF0, 0x00, 0x00, 0x01, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFB,
+  0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF,
+  0x03, 0xF0, 0x7F, 0xF8, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x3F, 0xF8, 0x3F,
+  0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x3F, 0xF8, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC,
+  0xFF, 0x03, 0xF0, 0x3F, 0xFC, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00, 0xF8, 0xF8, 0xFF,
+  0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xFC, 0x00, 0x00,
+  0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0,
+  0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00,
+  0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00,
+  0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x01, 0xF0,
+  0x3F, 0xF9, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x01, 0xF0, 0x7F, 0xF9, 0xFF, 0x00, 0xC0, 0xFC, 0xFF,
+  0x01, 0xF0, 0x3F, 0xF9, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x01, 0xF8, 0x1F, 0xF9, 0xFF, 0x00, 0xC0,
+  0xFC, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00,
+  0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00,
+  0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0,
+  0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xFB, 0xFF,
+  0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00,
+  0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x01, 0xC0, 0x0F, 0xFA, 0xFF,
+  0x00, 0xC0, 0xFC, 0xFF, 0x02, 0xFE, 0x00, 0x01, 0xFA, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x02, 0xFC,
+  0x00, 0x00, 0xFA, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0xFB, 0xFF, 0x00,
+  0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0,
+  0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xFB, 0xFF,
+  0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x1F, 0xE0, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03,
+  0xF0, 0x3F, 0xF8, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x7F, 0xF8, 0x1F, 0xFB,
+  0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x3F, 0xF8, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF,
+  0x03, 0xF8, 0x3F, 0xF0, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00, 0xF8, 0xFE, 0x00, 0x00,
+  0x1F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00, 0xF0, 0xFE, 0x00, 0x00, 0x1F, 0xFC, 0xFF, 0x00,
+  0xC0, 0xFC, 0xFF, 0x00, 0xF0, 0xFE, 0x00, 0x00, 0x1F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00,
+  0xF0, 0xFE, 0x00, 0x00, 0x1F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00, 0xF0, 0xFE, 0x00, 0x00,
+  0x1F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00, 0xF0, 0xFE, 0x00, 0x00, 0x1F, 0xFC, 0xFF, 0x00,
+  0xC0, 0xFC, 0xFF, 0x00, 0xF0, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00,
+  0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF8, 0xFF, 0x00, 0x3F, 0xFC, 0xFF, 0x00,
+  0xC0, 0xFC, 0xFF, 0x04, 0xF0, 0x00, 0x00, 0x3C, 0x0F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x04,
+  0xF0, 0x00, 0x00, 0x38, 0x07, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x04, 0xF0, 0x00, 0x00, 0x38,
+  0x07, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x04, 0xF0, 0x00, 0x00, 0x38, 0x07, 0xFC, 0xFF, 0x00,
+  0xC0, 0xFC, 0xFF, 0x04, 0xF0, 0x00, 0x00, 0x38, 0x07, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x04,
+  0xF0, 0x00, 0x00, 0x3C, 0x0F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x04, 0xF0, 0x00, 0x00, 0x3C,
+  0x0F, 0xFC, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00,
+  0xC0, 0xFB, 0xFF, 0x01, 0xC0, 0x0F, 0xFA, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x01, 0x00, 0x01, 0xFA,
+  0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x02, 0xFE, 0x00, 0x00, 0xFA, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03,
+  0xFC, 0x00, 0x00, 0x7F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xFB,
+  0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF,
+  0x03, 0xF0, 0x00, 0x00, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x1F, 0xF0, 0x1F,
+  0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x3F, 0xF8, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC,
+  0xFF, 0x03, 0xF0, 0x7F, 0xF8, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x7F, 0xF8,
+  0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x3F, 0xF0, 0x1F, 0xFB, 0xFF, 0x00, 0xC0,
+  0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00,
+  0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00,
+  0xC0, 0xFC, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x02, 0xFC,
+  0x00, 0x00, 0xFA, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x01, 0x00, 0x01, 0xFA, 0xFF, 0x00, 0xC0, 0xFB,
+  0xFF, 0x01, 0xC0, 0x07, 0xFA, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0,
+  0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0,
+  0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0,
+  0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0,
+};
+
+const EPD_ASSET epd_asset_image2 = { 250, 122, 0, 250, 122, 2344, epd_asset_image2_data };
+
+static const uint8_t epd_asset_image3_data[] = {
+  0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0,
+  0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0,
+  0xF2, 0xFF, 0x00, 0xC0, 0xF7, 0xFF, 0x05, 0xFE, 0x1F, 0xFC, 0xFF, 0xFF, 0xC0, 0xF7, 0xFF, 0x05,
+  0xFE, 0x0F, 0xF8, 0x7F, 0xFF, 0xC0, 0xF7, 0xFF, 0x05, 0xFE, 0x03, 0xF8, 0x3F, 0xFF, 0xC0, 0xF7,
+  0xFF, 0x05, 0xFE, 0x01, 0xF8, 0x3F, 0xFF, 0xC0, 0xF7, 0xFF, 0x05, 0xFE, 0x00, 0xFC, 0x3F, 0xFF,
+  0xC0, 0xF7, 0xFF, 0x05, 0xFE, 0x00, 0x7C, 0x3F, 0xFF, 0xC0, 0xF7, 0xFF, 0x05, 0xFE, 0x00, 0x18,
+  0x3F, 0xFF, 0xC0, 0xF7, 0xFF, 0x05, 0xFE, 0x10, 0x00, 0x3F, 0xFF, 0xC0, 0xF7, 0xFF, 0x05, 0xFE,
+  0x18, 0x00, 0x3F, 0xFF, 0xC0, 0xF7, 0xFF, 0x05, 0xFE, 0x1E, 0x00, 0x7F, 0xFF, 0xC0, 0xF7, 0xFF,
+  0x05, 0xFE, 0x1F, 0x00, 0x7F, 0xFF, 0xC0, 0xF7, 0xFF, 0x05, 0xFE, 0x1F, 0xC1, 0xFF, 0xFF, 0xC0,
+  0xF2, 0xFF, 0x00, 0xC0, 0xF6, 0xFF, 0x00, 0x0F, 0xFE, 0xFF, 0x00, 0xC0, 0xF7, 0xFF, 0x01, 0xFE,
+  0x0F, 0xFE, 0xFF, 0x00, 0xC0, 0xF7, 0xFF, 0x01, 0xFE, 0x0F, 0xFE, 0xFF, 0x00, 0xC0, 0xF7, 0xFF,
+  0x01, 0xFE, 0x0F, 0xFE, 0xFF, 0x00, 0xC0, 0xF7, 0xFF, 0x01, 0xFE, 0x0F, 0xFE, 0xFF, 0x00, 0xC0,
+  0xF6, 0xFF, 0x00, 0x1F, 0xFE, 0xFF, 0x00, 0xC0, 0xF5, 0xFF, 0x03, 0xF1, 0xFF, 0xFF, 0xC0, 0xF5,
+  0xFF, 0x03, 0xE1, 0xFF, 0xFF, 0xC0, 0xF5, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0xC0, 0xF5, 0xFF, 0x03,
+  0xE0, 0x7F, 0xFF, 0xC0, 0xF5, 0xFF, 0x03, 0xF0, 0x7F, 0xFF, 0xC0, 0xF7, 0xFF, 0x05, 0xFE, 0x00,
+  0x00, 0x3F, 0xFF, 0xC0, 0xF7, 0xFF, 0x05, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xF7, 0xFF, 0x05,
+  0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xF7, 0xFF, 0x05, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xF7,
+  0xFF, 0x05, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF6, 0xFF, 0x04, 0x9F,
+  0xFE, 0xFF, 0xFF, 0xC0, 0xF6, 0xFF, 0x04, 0x0F, 0xFC, 0x7F, 0xFF, 0xC0, 0xF6, 0xFF, 0x04, 0x0F,
+  0xF8, 0x7F, 0xFF, 0xC0, 0xF7, 0xFF, 0x05, 0xFE, 0x0F, 0xF8, 0x3F, 0xFF, 0xC0, 0xF7, 0xFF, 0x05,
+  0xFE, 0x0E, 0x1C, 0x3F, 0xFF, 0xC0, 0xF7, 0xFF, 0x05, 0xFE, 0x1E, 0x1C, 0x3F, 0xFF, 0xC0, 0xF7,
+  0xFF, 0x05, 0xFE, 0x1E, 0x1C, 0x3F, 0xFF, 0xC0, 0xF7, 0xFF, 0x05, 0xFE, 0x0C, 0x00, 0x3F, 0xFF,
+  0xC0, 0xF7, 0xFF, 0x05, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xF7, 0xFF, 0x05, 0xFE, 0x00, 0x00,
+  0x3F, 0xFF, 0xC0, 0xF6, 0xFF, 0xFF, 0x00, 0x02, 0x7F, 0xFF, 0xC0, 0xF6, 0xFF, 0x04, 0x80, 0x40,
+  0xFF, 0xFF, 0xC0, 0xF6, 0xFF, 0x00, 0xC1, 0xFE, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2,
+  0xFF, 0x00, 0xC0, 0xFE, 0xFF, 0x00, 0xE3, 0xF9, 0xFF, 0x03, 0xE3, 0x0F, 0xFF, 0xC0, 0xFE, 0xFF,
+  0x00, 0xC3, 0xF9, 0xFF, 0x03, 0xE0, 0x0F, 0xFF, 0xC0, 0xFE, 0xFF, 0x00, 0xC1, 0xF9, 0xFF, 0x03,
+  0xF0, 0x0F, 0xFF, 0xC0, 0xFE, 0xFF, 0x00, 0xC0, 0xF9, 0xFF, 0x03, 0xF8, 0x0F, 0xFF, 0xC0, 0xFE,
+  0xFF, 0x00, 0xE0, 0xF9, 0xFF, 0x08, 0xFC, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xF7,
+  0xFF, 0x05, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xF7, 0xFF, 0x05, 0xC0, 0xFF, 0xFC, 0x00, 0x00,
+  0x7F, 0xFA, 0xFF, 0x08, 0xF3, 0x9F, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFA, 0xFF, 0x08,
+  0xE1, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFA, 0xFF, 0x03, 0xE0, 0x0F, 0xFF, 0xC0,
+  0xF5, 0xFF, 0x03, 0xF0, 0x0F, 0xFF, 0xC0, 0xFE, 0xFF, 0x00, 0xF9, 0xF9, 0xFF, 0x07, 0xF8, 0x0F,
+  0xFF, 0xC0, 0xFF, 0xFC, 0x1F, 0xF0, 0xF9, 0xFF, 0x07, 0xFE, 0x1F, 0xFF, 0xC0, 0xFF, 0xFC, 0x0F,
+  0xF0, 0xF6, 0xFF, 0x05, 0xC0, 0xFF, 0xFC, 0x07, 0xF0, 0x7F, 0xF7, 0xFF, 0x05, 0xC0, 0xFF, 0xFC,
+  0x03, 0xF0, 0x7F, 0xF7, 0xFF, 0x05, 0xC0, 0xFF, 0xFC, 0x00, 0xF8, 0x7F, 0xF7, 0xFF, 0x05, 0xC0,
+  0xFF, 0xFC, 0x00, 0x78, 0x7F, 0xF7, 0xFF, 0x05, 0xC0, 0xFF, 0xFC, 0x20, 0x00, 0x7F, 0xF7, 0xFF,
+  0x05, 0xC0, 0xFF, 0xFC, 0x30, 0x00, 0x7F, 0xF7, 0xFF, 0x05, 0xC0, 0xFF, 0xFC, 0x38, 0x00, 0x7F,
+  0xF7, 0xFF, 0x04, 0xC0, 0xFF, 0xFC, 0x3C, 0x00, 0xFB, 0xFF, 0x09, 0xFE, 0x00, 0x00, 0x3F, 0xFF,
+  0xC0, 0xFF, 0xFC, 0x3F, 0x01, 0xFB, 0xFF, 0x08, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFE,
+  0x3F, 0xFA, 0xFF, 0x09, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFC, 0x3F, 0xF9, 0xFB, 0xFF,
+  0x09, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFC, 0x1F, 0xF0, 0xFB, 0xFF, 0x0A, 0xFE, 0x00,
+  0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFC, 0x07, 0xF0, 0x7F, 0xFC, 0xFF, 0x0A, 0xFE, 0x1E, 0x1E, 0x3F,
+  0xFF, 0xC0, 0xFF, 0xFC, 0x03, 0xF0, 0x7F, 0xFC, 0xFF, 0x0A, 0xFE, 0x1E, 0x1E, 0x3F, 0xFF, 0xC0,
+  0xFF, 0xFC, 0x01, 0xF8, 0x7F, 0xFC, 0xFF, 0x0A, 0xFE, 0x1E, 0x1E, 0x3F, 0xFF, 0xC0, 0xFF, 0xFC,
+  0x00, 0xF8, 0x7F, 0xFC, 0xFF, 0x0A, 0xFE, 0x1E, 0x1E, 0x3F, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x30,
+  0x7F, 0xFC, 0xFF, 0x0A, 0xFE, 0x1E, 0x1E, 0x3F, 0xFF, 0xC0, 0xFF, 0xFC, 0x20, 0x00, 0x7F, 0xFC,
+  0xFF, 0x0A, 0xFE, 0x1F, 0xFE, 0x3F, 0xFF, 0xC0, 0xFF, 0xFC, 0x30, 0x00, 0x7F, 0xF7, 0xFF, 0x04,
+  0xC0, 0xFF, 0xFC, 0x3C, 0x00, 0xF6, 0xFF, 0x04, 0xC0, 0xFF, 0xFC, 0x3E, 0x00, 0xFB, 0xFF, 0x09,
+  0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x3F, 0x83, 0xFB, 0xFF, 0x05, 0xC0, 0x00, 0x03,
+  0xFF, 0xFF, 0xC0, 0xF7, 0xFF, 0x05, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xF7, 0xFF, 0x05, 0xC0,
+  0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xF7, 0xFF, 0x05, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xF7, 0xFF,
+  0x05, 0xFE, 0x1F, 0xC3, 0xFF, 0xFF, 0xC0, 0xF7, 0xFF, 0x05, 0xFE, 0x1F, 0xE3, 0xFF, 0xFF, 0xC0,
+  0xF7, 0xFF, 0x07, 0xFE, 0x07, 0x81, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0xF9, 0xFF, 0x09, 0xFE, 0x00,
+  0x01, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x3F, 0xC7, 0xFB, 0xFF, 0x09, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
+  0xC0, 0xFF, 0xFC, 0x0F, 0x87, 0xFA, 0xFF, 0x08, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x06,
+  0x07, 0xFA, 0xFF, 0x08, 0x80, 0x07, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x07, 0xFA, 0xFF, 0x08,
+  0xE0, 0x1F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x07, 0xFA, 0xFF, 0x00, 0xEF, 0xFE, 0xFF, 0x04,
+  0xC0, 0xFF, 0xFF, 0x80, 0x0F, 0xFA, 0xFF, 0x08, 0x01, 0xF3, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0x80,
+  0x1F, 0xFB, 0xFF, 0x09, 0xFE, 0x00, 0xC3, 0xFF, 0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0x07, 0xFB, 0xFF,
+  0x09, 0xFE, 0x00, 0xC3, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x07, 0xFB, 0xFF, 0x09, 0xFE, 0x00,
+  0x43, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x02, 0x07, 0xFB, 0xFF, 0x09, 0xFE, 0x00, 0x61, 0xFF, 0xFF,
+  0xC0, 0xFF, 0xFC, 0x0F, 0x87, 0xFB, 0xFF, 0x09, 0xFE, 0x18, 0x61, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC,
+  0x3F, 0xC7, 0xFB, 0xFF, 0x07, 0xFE, 0x0C, 0x01, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0xF8, 0xFF, 0x04,
+  0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xF7, 0xFF, 0x05, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xF7, 0xFF,
+  0x05, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xF7, 0xFF, 0x05, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xC0,
+  0xF7, 0xFF, 0x05, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xFE, 0xFF, 0x00,
+  0xF9, 0xF6, 0xFF, 0x04, 0xC0, 0xFF, 0xFC, 0x1F, 0xF0, 0xFB, 0xFF, 0x09, 0xC0, 0x00, 0x03, 0xFF,
+  0xFF, 0xC0, 0xFF, 0xFC, 0x0F, 0xF0, 0xFB, 0xFF, 0x0A, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF,
+  0xFC, 0x07, 0xF0, 0x7F, 0xFC, 0xFF, 0x0A, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x03,
+  0xF0, 0x7F, 0xFC, 0xFF, 0x0A, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0xF8, 0x7F,
+  0xFC, 0xFF, 0x0A, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x78, 0x7F, 0xFC, 0xFF,
+  0x0A, 0xFE, 0x1F, 0xC3, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x20, 0x00, 0x7F, 0xFC, 0xFF, 0x0A, 0xFE,
+  0x1F, 0xE3, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x30, 0x00, 0x7F, 0xFC, 0xFF, 0x0A, 0xFE, 0x07, 0x81,
+  0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x38, 0x00, 0x7F, 0xFC, 0xFF, 0x09, 0xFE, 0x00, 0x01, 0xFF, 0xFF,
+  0xC0, 0xFF, 0xFC, 0x3C, 0x00, 0xFB, 0xFF, 0x09, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC,
+  0x3F, 0x01, 0xFA, 0xFF, 0x07, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFE, 0x3F, 0xF9, 0xFF, 0x07,
+  0x80, 0x07, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0x3F, 0xF9, 0xFF, 0x09, 0xE0, 0x1F, 0xFF, 0xFF, 0xC0,
+  0xFF, 0xFE, 0x1E, 0x00, 0x7F, 0xF7, 0xFF, 0x05, 0xC0, 0xFF, 0xFE, 0x1E, 0x00, 0x7F, 0xFB, 0xFF,
+  0x09, 0xC0, 0x1F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x1E, 0x00, 0x7F, 0xFB, 0xFF, 0x09, 0x80, 0x07,
+  0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x1E, 0x00, 0x7F, 0xFB, 0xFF, 0x09, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
+  0xFF, 0xFC, 0x3E, 0x00, 0x7F, 0xFC, 0xFF, 0x0A, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC,
+  0x3E, 0x18, 0x7F, 0xFC, 0xFF, 0x0A, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x1C, 0x18,
+  0x7F, 0xFC, 0xFF, 0x0A, 0xFE, 0x08, 0xC1, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x18, 0x7F, 0xFC,
+  0xFF, 0x0A, 0xFE, 0x18, 0xE1, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x18, 0x7F, 0xFC, 0xFF, 0x0A,
+  0xFE, 0x18, 0x83, 0xFF, 0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0x38, 0x7F, 0xFC, 0xFF, 0x0A, 0xFE, 0x18,
+  0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0x00, 0x38, 0x7F, 0xFC, 0xFF, 0x08, 0xFE, 0x08, 0x03, 0xFF,
+  0xFF, 0xC0, 0xFF, 0xFF, 0x80, 0xF9, 0xFF, 0x04, 0x08, 0x07, 0xFF, 0xFF, 0xC0, 0xF6, 0xFF, 0x08,
+  0x18, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xE0, 0x07, 0xFA, 0xFF, 0x08, 0xF8, 0x3F, 0xFF, 0xFF,
+  0xC0, 0xFF, 0xFF, 0x00, 0x01, 0xF6, 0xFF, 0x04, 0xC0, 0xFF, 0xFE, 0x00, 0x00, 0xFB, 0xFF, 0x0A,
+  0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x0A, 0xFE, 0x00,
+  0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x0A, 0xFE, 0x00, 0x03, 0xFF,
+  0xFF, 0xC0, 0xFF, 0xFC, 0x0F, 0xE0, 0x7F, 0xFC, 0xFF, 0x0A, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
+  0xFF, 0xFC, 0x3F, 0xF8, 0x7F, 0xFC, 0xFF, 0x0A, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC,
+  0x1F, 0xF0, 0x7F, 0xFA, 0xFF, 0x08, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFA,
+  0xFF, 0x08, 0x83, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFA, 0xFF, 0x07, 0xC3, 0xFF,
+  0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0x00, 0xF9, 0xFF, 0x07, 0xC3, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0x00,
+  0x01, 0xF9, 0xFF, 0x07, 0xFB, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x07, 0xF6, 0xFF, 0x00, 0xC0,
+  0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0,
+  0xF2, 0xFF, 0x00, 0xC0, 0xF7, 0xFF, 0x05, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0xF7, 0xFF, 0x05,
+  0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xF7, 0xFF, 0x0A, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xFF,
+  0xFC, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x0A, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFC, 0x00,
+  0x00, 0x7F, 0xFC, 0xFF, 0x0A, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x7F,
+  0xFB, 0xFF, 0x09, 0xFC, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFB, 0xFF, 0x09,
+  0x80, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFB, 0xFF, 0x09, 0x80, 0x00, 0x7F,
+  0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFB, 0xFF, 0x09, 0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF,
+  0xFC, 0x3C, 0x3C, 0x7F, 0xFB, 0xFF, 0x09, 0x80, 0x07, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x3C, 0x3C,
+  0x7F, 0xFB, 0xFF, 0x09, 0x80, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFC, 0x3C, 0x3C, 0x7F, 0xFB, 0xFF,
+  0x09, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFC, 0x3C, 0x3C, 0x7F, 0xFB, 0xFF, 0x09, 0xFC, 0x00,
+  0x3F, 0xFF, 0xC0, 0xFF, 0xFC, 0x3C, 0x3C, 0x7F, 0xFC, 0xFF, 0x0A, 0xFE, 0x00, 0x00, 0x3F, 0xFF,
+  0xC0, 0xFF, 0xFC, 0x3F, 0xFC, 0x7F, 0xFC, 0xFF, 0x05, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xF7,
+  0xFF, 0x09, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x7F, 0xFB, 0xFF, 0x09, 0xFE,
+  0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x7F, 0xFB, 0xFF, 0x01, 0xFE, 0x00, 0xFE, 0xFF,
+  0x04, 0xC0, 0xFF, 0xFF, 0xF8, 0x7F, 0xF6, 0xFF, 0x04, 0xC0, 0xFF, 0xFF, 0xF8, 0x7F, 0xFA, 0xFF,
+  0x08, 0xE0, 0x1F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x7F, 0xFA, 0xFF, 0x08, 0x80, 0x0F, 0xFF,
+  0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x7F, 0xFA, 0xFF, 0x08, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
+  0xF8, 0x7F, 0xFB, 0xFF, 0x09, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x7F, 0xFB,
+  0xFF, 0x09, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x7F, 0xFB, 0xFF, 0x05, 0xFE,
+  0x07, 0x83, 0xFF, 0xFF, 0xC0, 0xF7, 0xFF, 0x05, 0xFE, 0x1F, 0xE1, 0xFF, 0xFF, 0xC0, 0xF7, 0xFF,
+  0x0A, 0xFE, 0x1F, 0xC1, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x0A, 0xFE,
+  0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x0A, 0xFE, 0x00, 0x03,
+  0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFB, 0xFF, 0x09, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
+  0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFB, 0xFF, 0x09, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x00,
+  0x00, 0x7F, 0xFB, 0xFF, 0x07, 0xC0, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x3F, 0xF9, 0xFF, 0x00,
+  0xF8, 0xFE, 0xFF, 0x03, 0xC0, 0xFF, 0xFC, 0x3F, 0xF9, 0xFF, 0x00, 0xFD, 0xFE, 0xFF, 0x03, 0xC0,
+  0xFF, 0xFC, 0x3F, 0xF9, 0xFF, 0x07, 0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x3F, 0xF9, 0xFF,
+  0x07, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x3F, 0xFA, 0xFF, 0x08, 0xFE, 0x00, 0x03, 0xFF,
+  0xFF, 0xC0, 0xFF, 0xFC, 0x3F, 0xFA, 0xFF, 0x05, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xF7, 0xFF,
+  0x0A, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x0A, 0xFE,
+  0x1F, 0xC1, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x0A, 0xFE, 0x1F, 0xE3,
+  0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x0A, 0xFE, 0x00, 0x00, 0x0F, 0xFF,
+  0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x0A, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0xFF,
+  0xFC, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x05, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0xF7, 0xFF, 0x05,
+  0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0xF7, 0xFF, 0x05, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0xF7,
+  0xFF, 0x0A, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xF7, 0xFF, 0x05,
+  0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xF7, 0xFF, 0x05, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFB,
+  0xFF, 0x09, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x0A, 0xFE,
+  0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x0A, 0xFE, 0x00, 0x03,
+  0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFC, 0xFF, 0x09, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
+  0xC0, 0xFF, 0xFF, 0x80, 0x00, 0xFB, 0xFF, 0x09, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC,
+  0x00, 0x07, 0xFB, 0xFF, 0x01, 0xFE, 0x1F, 0xFE, 0xFF, 0x04, 0xC0, 0xFF, 0xFC, 0x00, 0x3F, 0xFB,
+  0xFF, 0x0A, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x0A,
+  0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x0A, 0xFE, 0x00,
+  0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x0A, 0xFE, 0x00, 0x03, 0xFF,
+  0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x0A, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
+  0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x05, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xF2, 0xFF,
+  0x00, 0xC0, 0xF2, 0xFF, 0x05, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFB, 0xFF, 0xFF, 0x00, 0x07,
+  0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x0A, 0xFE, 0x00, 0x00, 0x0F, 0xFF,
+  0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x0A, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0xFF,
+  0xFC, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x0A, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x00,
+  0x00, 0x7F, 0xFC, 0xFF, 0x09, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x0F, 0xFB,
+  0xFF, 0x01, 0xFE, 0x1F, 0xFE, 0xFF, 0x04, 0xC0, 0xFF, 0xFF, 0xE0, 0x07, 0xFB, 0xFF, 0x01, 0xFE,
+  0x3F, 0xFE, 0xFF, 0x04, 0xC0, 0xFF, 0xFF, 0x80, 0x01, 0xFA, 0xFF, 0x08, 0xE0, 0x1F, 0xFF, 0xFF,
+  0xC0, 0xFF, 0xFF, 0x00, 0x00, 0xFA, 0xFF, 0x09, 0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x00,
+  0x00, 0x7F, 0xFB, 0xFF, 0x09, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x01, 0xC0, 0x7F, 0xFC,
+  0xFF, 0x0A, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x07, 0xF0, 0x7F, 0xFC, 0xFF, 0x0A,
+  0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x0F, 0xF8, 0x7F, 0xFC, 0xFF, 0x0A, 0xFE, 0x08,
+  0xC1, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x3F, 0xFE, 0x7F, 0xFC, 0xFF, 0x07, 0xFE, 0x18, 0xE1, 0xFF,
+  0xFF, 0xC0, 0xFF, 0xFC, 0xF9, 0xFF, 0x05, 0xFE, 0x18, 0xC1, 0xFF, 0xFF, 0xC0, 0xF7, 0xFF, 0x05,
+  0xFE, 0x18, 0x03, 0xFF, 0xFF, 0xC0, 0xF7, 0xFF, 0x05, 0xFE, 0x08, 0x03, 0xFF, 0xFF, 0xC0, 0xF6,
+  0xFF, 0x04, 0x08, 0x03, 0xFF, 0xFF, 0xC0, 0xF6, 0xFF, 0x04, 0x18, 0x07, 0xFF, 0xFF, 0xC0, 0xF6,
+  0xFF, 0x04, 0xF8, 0x1F, 0xFF, 0xFF, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2,
+  0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2,
+  0xFF, 0x00, 0xC0,
+};
+
+const EPD_ASSET epd_asset_image3 = { 250, 122, 0, 250, 122, 2611, epd_asset_image3_data };
+
+static const uint8_t epd_asset_image4_data[] = {
+  0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0,
+  0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0,
+  0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0,
+  0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF9, 0xFF, 0x01, 0xE0, 0x7F, 0xFC, 0xFF, 0x00,
+  0xC0, 0xFA, 0xFF, 0x02, 0xF0, 0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x03, 0xFC, 0x00,
+  0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0xFF,
+  0x00, 0xC0, 0xFC, 0xFF, 0x00, 0xF0, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF,
+  0x00, 0xF0, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00, 0xF0, 0xFE, 0x00,
+  0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x02, 0xF0, 0x00, 0x00, 0xFA, 0xFF, 0x00, 0xC0,
+  0xFC, 0xFF, 0x01, 0xF0, 0x00, 0xF9, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x02, 0xF0, 0x00, 0x0F, 0xFA,
+  0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF,
+  0x00, 0xF0, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00, 0xFC, 0xFE, 0x00,
+  0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x00,
+  0xC0, 0xFA, 0xFF, 0x02, 0xE0, 0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFA, 0xFF, 0x02, 0x80, 0x00,
+  0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x03, 0xC0, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0,
+  0xFC, 0xFF, 0x00, 0xF0, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00, 0xF0,
+  0xFE, 0x00, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00,
+  0xC0, 0xFC, 0xFF, 0x02, 0xF0, 0x00, 0x1F, 0xFA, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x02, 0xF0, 0x00,
+  0x7F, 0xFA, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0xFB, 0xFF, 0x00, 0xC0,
+  0xFC, 0xFF, 0x00, 0xF0, 0xFE, 0x00, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00, 0xF0, 0xFE, 0x00,
+  0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00, 0xF0, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0xFF,
+  0x00, 0xC0, 0xFB, 0xFF, 0x03, 0x80, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x03,
+  0xFE, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFA, 0xFF, 0x02, 0xFC, 0x00, 0x7F, 0xFC, 0xFF,
+  0x00, 0xC0, 0xF9, 0xFF, 0x01, 0xF0, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xFB,
+  0xFF, 0x01, 0xF8, 0x7F, 0xFA, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x01, 0x80, 0x03, 0xFA, 0xFF, 0x00,
+  0xC0, 0xFC, 0xFF, 0x02, 0xFE, 0x00, 0x01, 0xFA, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xFC, 0x00,
+  0x00, 0x7F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0xFB, 0xFF, 0x00,
+  0xC0, 0xFC, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0,
+  0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x08, 0x20, 0x1F, 0xFB, 0xFF,
+  0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x38, 0x38, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03,
+  0xF0, 0x78, 0x3C, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x78, 0x3C, 0x1F, 0xFB,
+  0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x78, 0x38, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF,
+  0x03, 0xF0, 0x78, 0x00, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x38, 0x00, 0x3F,
+  0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x18, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC,
+  0xFF, 0x03, 0xF8, 0x18, 0x00, 0x7F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x02, 0xF8, 0x38, 0x00,
+  0xFA, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x02, 0xFC, 0x78, 0x01, 0xFA, 0xFF, 0x00, 0xC0, 0xFB, 0xFF,
+  0x01, 0xF8, 0x0F, 0xFA, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00, 0xF3, 0xF8, 0xFF, 0x00, 0xC0, 0xFC,
+  0xFF, 0x01, 0xF0, 0x7F, 0xF9, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x01, 0xF0, 0x07, 0xF9, 0xFF, 0x00,
+  0xC0, 0xFC, 0xFF, 0x02, 0xF0, 0x00, 0x7F, 0xFA, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x02, 0xF0, 0x00,
+  0x0F, 0xFA, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x02, 0xF0, 0x00, 0x00, 0xFA, 0xFF, 0x00, 0xC0, 0xFC,
+  0xFF, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF8, 0x00, 0x00,
+  0x01, 0xFB, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x03, 0x80, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0,
+  0xFB, 0xFF, 0x03, 0xC0, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x03, 0xC0, 0xE0,
+  0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x03, 0xC0, 0xFE, 0x00, 0x7F, 0xFC, 0xFF, 0x00,
+  0xC0, 0xFB, 0xFF, 0x03, 0xC0, 0xF8, 0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x03, 0xC0,
+  0x80, 0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x03, 0xC0, 0x00, 0x00, 0x7F, 0xFC, 0xFF,
+  0x00, 0xC0, 0xFB, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0,
+  0x00, 0x00, 0x03, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xFB, 0xFF,
+  0x00, 0xC0, 0xFC, 0xFF, 0x02, 0xF0, 0x00, 0x01, 0xFA, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x02, 0xF0,
+  0x00, 0x1F, 0xFA, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x01, 0xF0, 0x00, 0xF9, 0xFF, 0x00, 0xC0, 0xFC,
+  0xFF, 0x01, 0xF0, 0x0F, 0xF9, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00, 0xF0, 0xF8, 0xFF, 0x00, 0xC0,
+  0xF2, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x01, 0xC0, 0x0F, 0xFA, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x01,
+  0x00, 0x03, 0xFA, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x02, 0xFE, 0x00, 0x00, 0xFA, 0xFF, 0x00, 0xC0,
+  0xFC, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF8, 0x00,
+  0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00,
+  0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0,
+  0x1F, 0xE0, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x3F, 0xF8, 0x1F, 0xFB, 0xFF,
+  0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x7F, 0xF8, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03,
+  0xF0, 0x7F, 0xF8, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x3F, 0xF8, 0x1F, 0xFB,
+  0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x3F, 0xF0, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF,
+  0x03, 0xF0, 0x1F, 0xF0, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF8, 0x3F, 0xF0, 0x3F,
+  0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF8, 0x7F, 0xFC, 0x7F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC,
+  0xFF, 0x02, 0xFD, 0xFF, 0xFE, 0xFA, 0xFF, 0x00, 0xC0, 0xFA, 0xFF, 0x01, 0xF8, 0x3F, 0xFB, 0xFF,
+  0x00, 0xC0, 0xFA, 0xFF, 0x01, 0xF8, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0xFF, 0x00, 0x00,
+  0x01, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFB, 0xFF, 0x00, 0xC0,
+  0xFC, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00,
+  0x00, 0x01, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFB, 0xFF, 0x00,
+  0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0,
+  0x00, 0x00, 0x01, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x3F, 0xF8, 0x3F, 0xFB, 0xFF,
+  0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x7F, 0xF8, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03,
+  0xF0, 0x3F, 0xF8, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x3F, 0xF8, 0x3F, 0xFB,
+  0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00, 0xF8, 0xF8, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00, 0xF9, 0xF8,
+  0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2,
+  0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2,
+  0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x01, 0xFE, 0x3F, 0xF9, 0xFF, 0x00, 0xC0,
+  0xFC, 0xFF, 0x03, 0xFC, 0x1F, 0xF8, 0x07, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF8, 0x0F,
+  0xE0, 0x03, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF8, 0x0F, 0xC0, 0x01, 0xFB, 0xFF, 0x00,
+  0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x1F, 0xC0, 0x00, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0,
+  0x3F, 0x80, 0x00, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x04, 0xF0, 0x3F, 0x80, 0x00, 0x7F, 0xFC,
+  0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x04, 0xF0, 0x3F, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC,
+  0xFF, 0x04, 0xF0, 0x7F, 0x00, 0xE0, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x04, 0xF0, 0x7F,
+  0x01, 0xE0, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x04, 0xF0, 0x3E, 0x01, 0xF0, 0x7F, 0xFC,
+  0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x04, 0xF0, 0x3C, 0x03, 0xF0, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC,
+  0xFF, 0x04, 0xF0, 0x00, 0x03, 0xE0, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x04, 0xF0, 0x00,
+  0x07, 0xE0, 0x7F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x04, 0xF8, 0x00, 0x07, 0xC0, 0x7F, 0xFC,
+  0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF8, 0x00, 0x0F, 0x80, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF,
+  0x03, 0xFC, 0x00, 0x0F, 0xC0, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xFE, 0x00, 0x1F, 0xE1,
+  0xFB, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x02, 0x00, 0x3F, 0xF3, 0xFB, 0xFF, 0x00, 0xC0, 0xFB, 0xFF,
+  0x00, 0xE3, 0xF9, 0xFF, 0x00, 0xC0, 0xFA, 0xFF, 0x01, 0xF8, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFA,
+  0xFF, 0x01, 0xF8, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFA, 0xFF, 0x01, 0xF8, 0x3F, 0xFB, 0xFF, 0x00,
+  0xC0, 0xFC, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xFC,
+  0x00, 0x00, 0x01, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFB, 0xFF,
+  0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03,
+  0xF0, 0x00, 0x00, 0x01, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFB,
+  0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF,
+  0x03, 0xF0, 0x7F, 0xF8, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x3F, 0xF8, 0x3F,
+  0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x3F, 0xF8, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC,
+  0xFF, 0x03, 0xF0, 0x3F, 0xFC, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00, 0xF8, 0xF8, 0xFF,
+  0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xFC, 0x00, 0x00,
+  0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0,
+  0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00,
+  0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00,
+  0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x01, 0xF0,
+  0x3F, 0xF9, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x01, 0xF0, 0x7F, 0xF9, 0xFF, 0x00, 0xC0, 0xFC, 0xFF,
+  0x01, 0xF0, 0x3F, 0xF9, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x01, 0xF8, 0x1F, 0xF9, 0xFF, 0x00, 0xC0,
+  0xFC, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00,
+  0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00,
+  0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0,
+  0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xFB, 0xFF,
+  0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00,
+  0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x01, 0xC0, 0x0F, 0xFA, 0xFF,
+  0x00, 0xC0, 0xFC, 0xFF, 0x02, 0xFE, 0x00, 0x01, 0xFA, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x02, 0xFC,
+  0x00, 0x00, 0xFA, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0xFB, 0xFF, 0x00,
+  0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0,
+  0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xFB, 0xFF,
+  0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x1F, 0xE0, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03,
+  0xF0, 0x3F, 0xF8, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x7F, 0xF8, 0x1F, 0xFB,
+  0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x3F, 0xF8, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF,
+  0x03, 0xF8, 0x3F, 0xF0, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00, 0xF8, 0xFE, 0x00, 0x00,
+  0x1F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00, 0xF0, 0xFE, 0x00, 0x00, 0x1F, 0xFC, 0xFF, 0x00,
+  0xC0, 0xFC, 0xFF, 0x00, 0xF0, 0xFE, 0x00, 0x00, 0x1F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00,
+  0xF0, 0xFE, 0x00, 0x00, 0x1F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00, 0xF0, 0xFE, 0x00, 0x00,
+  0x1F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00, 0xF0, 0xFE, 0x00, 0x00, 0x1F, 0xFC, 0xFF, 0x00,
+  0xC0, 0xFC, 0xFF, 0x00, 0xF0, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00,
+  0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF8, 0xFF, 0x00, 0x3F, 0xFC, 0xFF, 0x00,
+  0xC0, 0xFC, 0xFF, 0x04, 0xF0, 0x00, 0x00, 0x3C, 0x0F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x04,
+  0xF0, 0x00, 0x00, 0x38, 0x07, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x04, 0xF0, 0x00, 0x00, 0x38,
+  0x07, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x04, 0xF0, 0x00, 0x00, 0x38, 0x07, 0xFC, 0xFF, 0x00,
+  0xC0, 0xFC, 0xFF, 0x04, 0xF0, 0x00, 0x00, 0x38, 0x07, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x04,
+  0xF0, 0x00, 0x00, 0x3C, 0x0F, 0xFC, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x04, 0xF0, 0x00, 0x00, 0x3C,
+  0x0F, 0xFC, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00,
+  0xC0, 0xFB, 0xFF, 0x01, 0xC0, 0x0F, 0xFA, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x01, 0x00, 0x01, 0xFA,
+  0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x02, 0xFE, 0x00, 0x00, 0xFA, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03,
+  0xFC, 0x00, 0x00, 0x7F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xFB,
+  0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF,
+  0x03, 0xF0, 0x00, 0x00, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x1F, 0xF0, 0x1F,
+  0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x3F, 0xF8, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC,
+  0xFF, 0x03, 0xF0, 0x7F, 0xF8, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x7F, 0xF8,
+  0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x3F, 0xF0, 0x1F, 0xFB, 0xFF, 0x00, 0xC0,
+  0xFC, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF0, 0x00,
+  0x00, 0x3F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00,
+  0xC0, 0xFC, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0xFB, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x02, 0xFC,
+  0x00, 0x00, 0xFA, 0xFF, 0x00, 0xC0, 0xFB, 0xFF, 0x01, 0x00, 0x01, 0xFA, 0xFF, 0x00, 0xC0, 0xFB,
+  0xFF, 0x01, 0xC0, 0x07, 0xFA, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0,
+  0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0,
+  0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0,
+  0xF2, 0xFF, 0x00, 0xC0, 0xF2, 0xFF, 0x00, 0xC0,
+};
+
+const EPD_ASSET epd_asset_image4 = { 250, 122, 0, 250, 122, 2344, epd_asset_image4_data };
@@ -0,0 +1,513 @@
+/*
+ * epdfont.c
+ *
+ * Generated by Tools/fontconv.py from Tools/fonts/epdfont_src.h, do not edit.
+ * Rotations: 0
+ */
+
+#include "epdfont.h"
+
+static const uint8_t epd_font8_metrics[] = {
+  0, 3, 3, 2, 2, 4, 1, 6, 1, 6, 1, 6, 1, 6, 2, 3,
+  2, 4, 2, 4, 1, 6, 1, 6, 3, 3, 1, 6, 2, 3, 1, 6,
+  1, 6, 2, 4, 1, 6, 1, 6, 1, 6, 1, 6, 1, 6, 1, 6,
+  1, 6, 1, 6, 2, 3, 2, 3, 1, 5, 1, 6, 2, 5, 1, 6,
+  1, 6, 1, 6, 1, 6, 1, 6, 1, 6, 1, 6, 1, 6, 1, 6,
+  1, 6, 2, 4, 1, 6, 1, 6, 1, 6, 1, 6, 1, 6, 1, 6,
+  1, 6, 1, 6, 1, 6, 1, 6, 1, 6, 1, 6, 1, 6, 1, 6,
+  1, 6, 1, 6, 1, 6, 2, 4, 1, 6, 2, 4, 1, 6, 1, 6,
+  2, 4, 1, 6, 1, 6, 1, 6, 1, 6, 1, 6, 1, 6, 1, 6,
+  1, 6, 2, 4, 1, 5, 1, 5, 2, 4, 1, 6, 1, 6, 1, 6,
+  1, 6, 1, 6, 1, 6, 1, 6, 1, 6, 1, 6, 1, 6, 1, 6,
+  1, 6, 1, 6, 1, 6, 0, 7, 0, 3, 0, 3, 0, 3, 1, 4,
+};
+
+static const uint8_t epd_font8_kern[] = {
+  55, 46, 3, 65, 84, 1, 70, 44, 4, 70, 46, 4, 70, 65, 1,
+  76, 39, 4, 76, 84, 2, 76, 86, 1, 76, 89, 2, 76, 121, 1,
+  80, 44, 4, 80, 46, 4, 84, 44, 2, 84, 45, 2, 84, 46, 2,
+  84, 65, 1, 84, 97, 2, 84, 99, 2, 84, 101, 2, 84, 111, 2,
+  84, 114, 2, 84, 117, 2, 84, 119, 2, 84, 121, 2, 89, 44, 2,
+  89, 46, 2, 89, 97, 1, 114, 44, 4, 114, 46, 4,
+};
+
+static const uint8_t epd_font12_metrics[] = {
+  0, 3, 2, 2, 1, 5, 0, 7, 0, 6, 0, 7, 0, 7, 0, 3,
+  3, 4, 1, 4, 0, 6, 0, 6, 0, 3, 0, 6, 1, 2, 0, 6,
+  0, 6, 1, 4, 0, 6, 0, 6, 0, 6, 0, 6, 0, 6, 0, 6,
+  0, 6, 0, 6, 2, 2, 2, 2, 1, 6, 0, 6, 1, 6, 0, 6,
+  0, 6, 0, 7, 0, 6, 0, 6, 0, 6, 0, 6, 0, 6, 0, 7,
+  0, 7, 0, 6, 0, 7, 0, 7, 0, 7, 0, 6, 0, 7, 0, 6,
+  0, 6, 0, 6, 0, 7, 0, 6, 0, 6, 0, 7, 0, 7, 0, 6,
+  0, 6, 0, 6, 0, 6, 2, 4, 1, 5, 1, 4, 1, 4, 0, 7,
+  2, 2, 1, 6, 0, 6, 1, 5, 1, 6, 1, 5, 1, 6, 1, 6,
+  0, 7, 1, 4, 0, 5, 0, 7, 0, 6, 0, 6, 0, 7, 1, 5,
+  0, 6, 1, 6, 0, 6, 1, 5, 1, 5, 0, 7, 0, 7, 0, 6,
+  0, 6, 0, 7, 1, 5, 2, 4, 3, 2, 1, 4, 0, 7, 1, 5,
+};
+
+static const uint8_t epd_font12_kern[] = {
+  55, 46, 2, 65, 84, 1, 65, 86, 2, 65, 87, 1, 65, 89, 1,
+  65, 118, 2, 65, 119, 1, 65, 121, 2, 70, 44, 3, 70, 46, 2,
+  70, 65, 2, 76, 39, 3, 76, 84, 1, 76, 86, 2, 76, 87, 1,
+  76, 89, 1, 76, 121, 1, 80, 44, 3, 80, 46, 2, 80, 65, 1,
+  84, 44, 2, 84, 45, 2, 84, 46, 1, 84, 65, 1, 84, 97, 1,
+  84, 99, 1, 84, 101, 1, 84, 111, 1, 84, 114, 1, 84, 117, 2,
+  84, 119, 2, 84, 121, 2, 86, 44, 4, 86, 46, 3, 86, 65, 2,
+  86, 97, 2, 86, 101, 2, 86, 111, 2, 87, 44, 2, 87, 46, 1,
+  87, 65, 1, 87, 97, 1, 87, 101, 1, 87, 111, 1, 89, 44, 2,
+  89, 46, 1, 89, 65, 1, 89, 97, 1, 89, 101, 1, 89, 111, 1,
+  114, 44, 3, 114, 46, 2, 121, 44, 3, 121, 46, 2,
+};
+
+static const uint8_t epd_font16_metrics[] = {
+  0, 4, 3, 3, 1, 7, 0, 8, 1, 6, 0, 8, 0, 9, 0, 4,
+  3, 5, 1, 5, 0, 8, 0, 8, 0, 4, 1, 8, 1, 3, 1, 8,
+  1, 7, 1, 6, 1, 7, 1, 7, 1, 7, 1, 7, 1, 7, 1, 7,
+  1, 7, 1, 7, 3, 3, 2, 3, 1, 7, 0, 8, 1, 7, 1, 7,
+  0, 8, 0, 9, 0, 8, 0, 8, 0, 8, 0, 8, 0, 8, 0, 8,
+  0, 9, 1, 6, 0, 8, 0, 8, 0, 8, 0, 8, 0, 9, 0, 8,
+  0, 8, 0, 8, 0, 9, 1, 7, 0, 8, 0, 9, 0, 9, 0, 8,
+  0, 9, 0, 8, 0, 8, 3, 5, 1, 7, 1, 5, 2, 6, 0, 9,
+  1, 4, 1, 8, 0, 8, 1, 7, 1, 8, 1, 7, 1, 8, 1, 7,
+  0, 9, 1, 6, 1, 6, 0, 8, 1, 6, 0, 9, 0, 9, 1, 7,
+  0, 8, 1, 8, 0, 8, 1, 7, 1, 6, 0, 9, 0, 9, 0, 9,
+  1, 7, 0, 9, 1, 7, 4, 5, 4, 2, 1, 5, 1, 8, 2, 5,
+};
+
+static const uint8_t epd_font16_kern[] = {
+  55, 46, 3, 65, 84, 2, 65, 86, 3, 65, 87, 1, 65, 89, 2,
+  65, 118, 2, 65, 119, 1, 65, 121, 2, 70, 44, 5, 70, 46, 4,
+  70, 65, 3, 76, 39, 4, 76, 84, 2, 76, 86, 3, 76, 87, 1,
+  76, 89, 2, 76, 121, 2, 80, 44, 5, 80, 46, 4, 80, 65, 2,
+  84, 44, 3, 84, 45, 3, 84, 46, 2, 84, 65, 2, 84, 97, 2,
+  84, 99, 3, 84, 101, 2, 84, 111, 2, 84, 114, 2, 84, 117, 3,
+  84, 119, 3, 84, 121, 3, 86, 44, 4, 86, 46, 3, 86, 65, 3,
+  86, 97, 2, 86, 101, 2, 86, 111, 2, 87, 44, 2, 87, 46, 1,
+  87, 65, 1, 89, 44, 3, 89, 46, 2, 89, 65, 2, 89, 97, 2,
+  89, 101, 2, 89, 111, 2, 114, 44, 3, 114, 46, 2, 121, 44, 4,
+  121, 46, 3,
+};
+
+static const uint8_t epd_font24_metrics[] = {
+  0, 6, 5, 4, 2, 10, 1, 11, 2, 9, 0, 12, 0, 12, 1, 5,
+  5, 7, 1, 7, 1, 12, 1, 12, 1, 5, 1, 11, 2, 4, 1, 11,
+  1, 11, 2, 9, 1, 10, 1, 10, 1, 11, 1, 10, 1, 11, 2, 10,
+  1, 11, 1, 11, 5, 4, 5, 3, 2, 10, 1, 11, 2, 10, 1, 11,
+  1, 12, 0, 13, 0, 12, 1, 11, 0, 12, 0, 12, 0, 12, 1, 12,
+  0, 13, 2, 9, 1, 12, 0, 13, 0, 12, 0, 13, 0, 13, 1, 11,
+  0, 12, 1, 11, 0, 13, 1, 11, 0, 13, 0, 13, 0, 13, 0, 13,
+  1, 11, 0, 13, 1, 11, 5, 7, 2, 10, 2, 7, 3, 8, 0, 13,
+  3, 5, 1, 12, 1, 11, 1, 10, 1, 11, 2, 10, 1, 11, 1, 12,
+  1, 11, 2, 9, 2, 8, 1, 11, 2, 9, 0, 13, 1, 11, 1, 11,
+  1, 11, 1, 11, 0, 12, 2, 10, 1, 10, 1, 11, 1, 12, 0, 13,
+  1, 11, 1, 11, 2, 10, 5, 6, 6, 2, 2, 6, 1, 12, 2, 7,
+};
+
+static const uint8_t epd_font24_kern[] = {
+  55, 46, 4, 65, 84, 4, 65, 86, 5, 65, 87, 3, 65, 89, 3,
+  65, 118, 3, 65, 119, 3, 65, 121, 3, 70, 44, 8, 70, 46, 7,
+  70, 65, 4, 76, 39, 8, 76, 84, 5, 76, 86, 4, 76, 87, 2,
+  76, 89, 4, 76, 121, 3, 80, 44, 8, 80, 46, 7, 80, 65, 3,
+  84, 44, 5, 84, 45, 5, 84, 46, 4, 84, 65, 4, 84, 97, 4,
+  84, 99, 5, 84, 101, 5, 84, 111, 5, 84, 114, 4, 84, 117, 2,
+  84, 119, 5, 84, 121, 5, 86, 44, 5, 86, 46, 4, 86, 65, 5,
+  86, 97, 4, 86, 101, 3, 86, 111, 3, 87, 44, 4, 87, 46, 3,
+  87, 65, 4, 87, 97, 3, 87, 101, 2, 87, 111, 2, 89, 44, 4,
+  89, 46, 3, 89, 65, 3, 89, 97, 3, 89, 101, 4, 89, 111, 4,
+  114, 44, 4, 114, 46, 3, 121, 44, 5, 121, 46, 4,
+};
+
+static const uint8_t epd_font8_r0_data[] = {
+  0x00, 0x01, 0x92, 0x6B, 0xD3, 0x53, 0xE3, 0x9A, 0x2E, 0x53, 0xF9, 0x4F, 0xE5, 0x0D, 0x17, 0x48,
+  0xAB, 0xFA, 0xA2, 0x46, 0x8B, 0xE2, 0xC8, 0x20, 0x9A, 0x33, 0x45, 0xDB, 0x49, 0xAA, 0x8A, 0x82,
+  0x4A, 0x75, 0xA6, 0x2E, 0x71, 0x14, 0x14, 0xC5, 0xE0, 0xA2, 0x38, 0x69, 0x2A, 0x89, 0xF2, 0x28,
+  0xD2, 0x52, 0x13, 0xE4, 0x23, 0x40, 0x75, 0x9A, 0x83, 0xF4, 0x84, 0xBC, 0xD2, 0x58, 0x20, 0x82,
+  0x09, 0xA2, 0xEF, 0xA8, 0xC9, 0x8A, 0xF9, 0x31, 0x78, 0x5F, 0xE0, 0x1A, 0x2F, 0x0B, 0x0D, 0x19,
+  0x31, 0x8D, 0x17, 0x43, 0x06, 0x2C, 0xB6, 0x26, 0x8B, 0x98, 0x28, 0x4B, 0xF9, 0x03, 0x45, 0xD3,
+  0xC5, 0x8B, 0x15, 0xC9, 0xA2, 0xEF, 0x25, 0x49, 0x92, 0xC0, 0xD1, 0x70, 0x3C, 0x44, 0x85, 0x06,
+  0x68, 0xBB, 0x69, 0x32, 0x64, 0xB6, 0x34, 0x5C, 0x34, 0x99, 0x2A, 0x4F, 0x24, 0x4B, 0xBD, 0xA4,
+  0x2D, 0x5B, 0x66, 0x0B, 0x88, 0x28, 0x8A, 0x09, 0xA6, 0x76, 0xDB, 0x54, 0x17, 0x82, 0x88, 0xA0,
+  0x83, 0x45, 0xC1, 0x01, 0xA2, 0x24, 0x31, 0xA2, 0xEC, 0xA4, 0xD9, 0xA2, 0xF8, 0xD1, 0x7F, 0x84,
+  0x88, 0x92, 0xF8, 0x68, 0xBF, 0xF9, 0x32, 0x64, 0xB6, 0x34, 0x5D, 0xF4, 0x18, 0x30, 0x51, 0x1A,
+  0x2F, 0xFE, 0x0C, 0x14, 0x47, 0x0D, 0x17, 0xFF, 0x26, 0x4C, 0x98, 0x26, 0x8B, 0xFF, 0x12, 0x24,
+  0x48, 0x13, 0x45, 0xDF, 0x41, 0x93, 0x27, 0xD1, 0xA2, 0xFF, 0xC4, 0x08, 0x11, 0xFD, 0x31, 0x78,
+  0x3F, 0xE0, 0x9A, 0x2E, 0x82, 0x04, 0x17, 0xE0, 0x4D, 0x17, 0xFE, 0x20, 0xA2, 0x28, 0x26, 0x8B,
+  0xFF, 0x81, 0x02, 0x04, 0x03, 0x45, 0xFF, 0x82, 0x18, 0x0B, 0xF9, 0xA2, 0xFF, 0xC2, 0x08, 0x21,
+  0xFC, 0xD1, 0x77, 0xD0, 0x60, 0xC1, 0x7C, 0x68, 0xBF, 0xF1, 0x22, 0x44, 0x86, 0x34, 0x5D, 0xF4,
+  0x1A, 0x28, 0x6F, 0x1A, 0x2F, 0xFC, 0x49, 0x95, 0x31, 0x8D, 0x17, 0x8D, 0x26, 0x4C, 0x96, 0x26,
+  0x8B, 0x81, 0x03, 0xFC, 0x08, 0x13, 0x45, 0xDF, 0xC0, 0x81, 0x01, 0xF9, 0xA2, 0xE7, 0xD0, 0x40,
+  0x40, 0x7C, 0xD1, 0x77, 0xF0, 0x1C, 0x40, 0x7E, 0x68, 0xBE, 0x32, 0x82, 0x0A, 0x63, 0x34, 0x5C,
+  0x38, 0x8E, 0x02, 0x03, 0x9A, 0x2F, 0x86, 0x8C, 0x98, 0xB0, 0xD3, 0x17, 0xFF, 0x06, 0x09, 0xA2,
+  0xF5, 0x55, 0x55, 0x55, 0x55, 0x31, 0x78, 0x30, 0x7F, 0x9A, 0xA7, 0x11, 0x50, 0xD1, 0x1F, 0xA6,
+  0xA6, 0x54, 0x34, 0x55, 0x15, 0xAD, 0x7C, 0x68, 0xBF, 0xF9, 0x11, 0x22, 0x38, 0x34, 0x55, 0xD1,
+  0x8C, 0x50, 0x68, 0xBB, 0x88, 0x91, 0x24, 0x7F, 0x34, 0x55, 0xD5, 0xAD, 0x4C, 0x68, 0xB8, 0x8F,
+  0xC2, 0x40, 0x82, 0x34, 0x18, 0x6A, 0x69, 0xA5, 0xF3, 0x45, 0xFF, 0x88, 0x08, 0x13, 0xC2, 0x62,
+  0xF1, 0x3E, 0xC0, 0x30, 0x21, 0x02, 0x02, 0x11, 0xF4, 0xC1, 0x7F, 0xE4, 0x14, 0x44, 0x4C, 0x5E,
+  0x0F, 0xF8, 0x06, 0x8A, 0xFC, 0x26, 0x0F, 0x8D, 0x15, 0xF8, 0x82, 0x1F, 0x1A, 0x2A, 0xE8, 0xC6,
+  0x2E, 0x34, 0x1B, 0xF2, 0x49, 0x24, 0x63, 0x41, 0x86, 0x24, 0x91, 0xBF, 0x34, 0x57, 0xE2, 0x08,
+  0x44, 0x68, 0xAC, 0xAB, 0x5A, 0xA0, 0xD1, 0x70, 0x8F, 0xE2, 0x40, 0x40, 0x68, 0xAB, 0xE1, 0x04,
+  0x7C, 0xD1, 0x53, 0xA2, 0x08, 0x39, 0xA2, 0xAF, 0x83, 0x20, 0xF3, 0x45, 0x62, 0xA2, 0x2A, 0x26,
+  0x83, 0x0F, 0x45, 0x14, 0x3E, 0x68, 0xAC, 0x73, 0x59, 0xC4, 0x63, 0x3B, 0x6D, 0xB4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x2D, 0x4D, 0x54,
+};
+
+static const uint16_t epd_font8_r0_index[] = {
+  0, 273, 517, 895, 1205, 1597, 1975, 2367,
+  2681, 3012, 3336, 3668,
+};
+
+static const uint8_t epd_font12_r0_data[] = {
+  0x00, 0x00, 0x44, 0xC8, 0xBF, 0x31, 0x83, 0xC7, 0x11, 0x8C, 0x82, 0x4F, 0x42, 0xFF, 0x42, 0xF2,
+  0x41, 0x4A, 0xA6, 0x31, 0x12, 0xFF, 0xD2, 0x23, 0x18, 0x63, 0x20, 0x1B, 0x24, 0xD9, 0xB2, 0x4D,
+  0x80, 0x63, 0x21, 0xC2, 0x3A, 0xE5, 0x3A, 0xE2, 0x00, 0x26, 0x0E, 0x36, 0xCA, 0xA3, 0xF1, 0x02,
+  0x80, 0x4B, 0x2A, 0xA0, 0x14, 0x08, 0xFC, 0x14, 0xE6, 0x48, 0xCF, 0xCC, 0x48, 0x53, 0x9C, 0x40,
+  0x8F, 0xE2, 0x04, 0x04, 0x41, 0xC6, 0x2A, 0x83, 0xF2, 0x4C, 0x18, 0xA5, 0x54, 0x00, 0xE0, 0x06,
+  0x00, 0x70, 0x02, 0x29, 0x90, 0xFD, 0x03, 0x03, 0x02, 0xFC, 0x59, 0x91, 0x05, 0xFF, 0x00, 0x29,
+  0x91, 0x8D, 0x43, 0x23, 0x13, 0x0C, 0x29, 0x90, 0x85, 0x03, 0x13, 0x12, 0xEC, 0x29, 0x90, 0x20,
+  0x58, 0x45, 0xFF, 0x40, 0x29, 0x90, 0x9F, 0x13, 0x13, 0x12, 0xE2, 0x29, 0x90, 0xFD, 0x13, 0x13,
+  0x16, 0xE0, 0x29, 0x90, 0x06, 0x03, 0xF2, 0x0E, 0x02, 0x29, 0x90, 0xED, 0x13, 0x13, 0x12, 0xEC,
+  0x29, 0x90, 0x1D, 0xA3, 0x23, 0x22, 0xFC, 0x89, 0x8D, 0x0A, 0x25, 0x36, 0x26, 0x99, 0x21, 0x01,
+  0x41, 0x11, 0x05, 0x01, 0x15, 0x04, 0x99, 0x99, 0x93, 0x4C, 0x98, 0x0A, 0x08, 0x88, 0x28, 0x08,
+  0x0A, 0x64, 0x03, 0x00, 0xD8, 0x84, 0x83, 0x0A, 0x64, 0x3F, 0x40, 0xDC, 0xD2, 0xDF, 0x0C, 0x64,
+  0x40, 0x7C, 0x13, 0x9E, 0x70, 0x40, 0x0A, 0x64, 0x40, 0xFF, 0xC4, 0xC4, 0xBB, 0x0A, 0x64, 0x3F,
+  0x40, 0xC0, 0xC0, 0xA1, 0x8A, 0x64, 0x40, 0xFF, 0xC0, 0xC0, 0xBF, 0x0A, 0x64, 0x40, 0xFF, 0xC4,
+  0xCE, 0xE1, 0x8A, 0x64, 0x40, 0xFF, 0xC4, 0x8E, 0x81, 0x8C, 0x64, 0x1E, 0x21, 0x40, 0xC8, 0xB9,
+  0x88, 0x0C, 0x64, 0x40, 0xFF, 0x84, 0x04, 0x7F, 0xC0, 0x8A, 0x64, 0x40, 0xC0, 0xFF, 0xC0, 0xC0,
+  0x8C, 0x54, 0xE0, 0x20, 0x30, 0x17, 0xF8, 0x04, 0x02, 0x31, 0x91, 0x03, 0xFF, 0x12, 0x69, 0x87,
+  0x02, 0x31, 0x91, 0x03, 0xFF, 0x03, 0x01, 0x01, 0x80, 0x29, 0x91, 0xFE, 0x1F, 0xE0, 0x1F, 0xFE,
+  0x31, 0x91, 0x03, 0xFF, 0x18, 0x63, 0xFE, 0x02, 0x29, 0x90, 0xFD, 0x03, 0x03, 0x02, 0xFC, 0x29,
+  0x91, 0x03, 0xFF, 0x12, 0x12, 0x0C, 0x29, 0x52, 0x7E, 0x50, 0xA8, 0x78, 0x37, 0xE1, 0x8C, 0x88,
+  0x1F, 0xF8, 0x91, 0x9E, 0x68, 0x01, 0x4C, 0x8C, 0x68, 0x98, 0x99, 0x16, 0x31, 0x4C, 0x80, 0x38,
+  0x1F, 0xF8, 0x10, 0x31, 0x8C, 0x80, 0x17, 0xF8, 0x08, 0x07, 0xF0, 0x11, 0x8C, 0x80, 0x11, 0xFE,
+  0x03, 0x80, 0x70, 0x11, 0x4C, 0x80, 0x7F, 0x80, 0xFF, 0x80, 0x71, 0x4C, 0x88, 0x1E, 0x71, 0x8E,
+  0x78, 0x11, 0x4C, 0x80, 0x18, 0x7F, 0x88, 0x70, 0x11, 0x4C, 0x88, 0x3E, 0x19, 0x98, 0x7C, 0x14,
+  0xCA, 0xAF, 0xFE, 0x01, 0x80, 0x4C, 0x32, 0x40, 0xE1, 0x87, 0x04, 0x00, 0xB2, 0xAA, 0x01, 0x80,
+  0x7F, 0xF2, 0xDA, 0x29, 0x86, 0x20, 0x7F, 0x45, 0xC1, 0x9A, 0x62, 0xAA, 0xB5, 0xF4, 0x05, 0x32,
+  0x00, 0x7F, 0xE2, 0x22, 0x1C, 0x0C, 0x31, 0x5D, 0x18, 0xCC, 0xD3, 0x21, 0xC2, 0x22, 0x27, 0xFE,
+  0x00, 0xC3, 0x15, 0xD5, 0xAD, 0x8D, 0x32, 0x22, 0x3F, 0xA2, 0x62, 0x40, 0x4D, 0x21, 0xDD, 0x55,
+  0xAB, 0x4D, 0x08, 0xC6, 0x44, 0x0F, 0xFC, 0x40, 0x47, 0x84, 0x01, 0x66, 0x44, 0x47, 0xCC, 0x00,
+  0x84, 0x54, 0x01, 0x00, 0x41, 0x0F, 0xC8, 0xC6, 0x44, 0x0F, 0xFD, 0x01, 0xC6, 0x44, 0x40, 0xA6,
+  0x44, 0x0C, 0x0F, 0xFC, 0x04, 0x00, 0xA6, 0x2F, 0xC3, 0xF0, 0xF8, 0x63, 0x16, 0x3F, 0x88, 0x7D,
+  0x03, 0x0C, 0x57, 0x46, 0x2E, 0x14, 0x87, 0x83, 0xFE, 0x89, 0x11, 0xC6, 0x90, 0xE3, 0x88, 0xD1,
+  0xFF, 0x00, 0x53, 0x16, 0x3F, 0x90, 0x42, 0x61, 0x8B, 0x3A, 0xD7, 0x26, 0x18, 0xE1, 0x1F, 0xC4,
+  0x80, 0x31, 0x8A, 0x17, 0xC2, 0x3F, 0x80, 0xC6, 0x28, 0x4F, 0x96, 0x0C, 0x22, 0x98, 0xA3, 0xE1,
+  0xF8, 0x31, 0x4C, 0x58, 0xEC, 0x9B, 0x88, 0xC4, 0x3C, 0x18, 0xEE, 0x46, 0x03, 0x02, 0x61, 0x8B,
+  0x1E, 0xCE, 0x29, 0x95, 0x40, 0x87, 0xDF, 0x00, 0xB2, 0x46, 0x7F, 0xF9, 0x65, 0x54, 0x03, 0xF7,
+  0x82, 0x03, 0x34, 0x68, 0xA9, 0x11, 0x8A, 0x23, 0x4C, 0xB0,
+};
+
+static const uint16_t epd_font12_r0_index[] = {
+  0, 348, 663, 1095, 1465, 1929, 2423, 2900,
+  3256, 3605, 4008, 4364,
+};
+
+static const uint8_t epd_font16_r0_data[] = {
+  0x00, 0x00, 0x0C, 0x84, 0xBC, 0xFF, 0x80, 0x05, 0x96, 0x48, 0x63, 0x86, 0x30, 0x71, 0x2C, 0x44,
+  0x7F, 0x81, 0x1E, 0x22, 0x3F, 0xC0, 0x8F, 0x11, 0x02, 0xA0, 0x70, 0xC3, 0x84, 0x11, 0x7F, 0xFE,
+  0x42, 0x10, 0xF1, 0x80, 0xE2, 0x58, 0x1E, 0x84, 0x2E, 0x78, 0x30, 0x3D, 0xC8, 0x46, 0xF0, 0x02,
+  0x04, 0xB7, 0x81, 0x0F, 0xA3, 0x0C, 0x91, 0x65, 0xD3, 0x82, 0x10, 0x20, 0x00, 0x35, 0x92, 0x2D,
+  0xCD, 0x02, 0xE0, 0xFC, 0x0C, 0x0C, 0x40, 0x0A, 0x00, 0x11, 0x40, 0xBA, 0x00, 0x14, 0x00, 0x8C,
+  0x0C, 0x0F, 0xC0, 0x1C, 0x88, 0x24, 0x24, 0x18, 0xFF, 0x18, 0x24, 0x24, 0x07, 0x1A, 0x42, 0x01,
+  0x00, 0x87, 0xFC, 0x20, 0x10, 0x08, 0x01, 0x80, 0x91, 0x6E, 0x2E, 0x70, 0xFF, 0x12, 0x10, 0xBC,
+  0x5C, 0x2D, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x22, 0xC2, 0x59,
+  0xFC, 0x40, 0x50, 0x06, 0x00, 0xA0, 0x23, 0xF8, 0x2A, 0x25, 0xC0, 0x28, 0x05, 0xFF, 0xE0, 0x04,
+  0x00, 0x16, 0x12, 0xF0, 0x75, 0x01, 0x90, 0x31, 0x06, 0x18, 0xE0, 0xE1, 0x61, 0x2D, 0x83, 0x40,
+  0x18, 0x23, 0x04, 0x51, 0x49, 0xC6, 0x16, 0x12, 0xC7, 0x00, 0x98, 0x90, 0x92, 0x0B, 0xFF, 0xC8,
+  0x01, 0x61, 0x2D, 0x9F, 0xC2, 0x18, 0x23, 0x04, 0x51, 0x09, 0xC1, 0x16, 0x12, 0xCF, 0xE2, 0x22,
+  0x82, 0x30, 0x45, 0x11, 0x9C, 0x01, 0x61, 0x2C, 0x03, 0x80, 0x1F, 0xC2, 0x06, 0x40, 0x38, 0x01,
+  0x16, 0x12, 0xDC, 0x74, 0x51, 0x84, 0x30, 0x86, 0x28, 0xB8, 0xE1, 0x61, 0x2C, 0x0E, 0x62, 0x28,
+  0x83, 0x10, 0x51, 0x11, 0xFC, 0x32, 0x12, 0x30, 0xF0, 0xC8, 0x80, 0x98, 0x03, 0x04, 0x58, 0x4B,
+  0x04, 0x01, 0x40, 0x44, 0x10, 0x44, 0x05, 0x00, 0x41, 0xCA, 0x58, 0xC6, 0x31, 0x8C, 0x62, 0x2C,
+  0x25, 0xC0, 0x14, 0x04, 0x41, 0x04, 0x40, 0x50, 0x04, 0x02, 0xC2, 0x58, 0x0E, 0x01, 0x38, 0x07,
+  0x60, 0x82, 0x10, 0x3C, 0x0E, 0x25, 0x8F, 0x86, 0x0D, 0x3E, 0x64, 0x2C, 0x7D, 0x50, 0x45, 0xF0,
+  0x20, 0x4B, 0x80, 0x1E, 0x02, 0x3C, 0x04, 0x70, 0xB9, 0x38, 0x38, 0x04, 0x00, 0x07, 0x12, 0xE0,
+  0x0F, 0xFF, 0x82, 0x30, 0x46, 0x08, 0xA2, 0xE3, 0x80, 0x0E, 0x25, 0x8F, 0x86, 0x0D, 0x00, 0x60,
+  0x0C, 0x01, 0x40, 0x24, 0x1C, 0x1C, 0x4B, 0x80, 0x3F, 0xFE, 0x00, 0xC0, 0x18, 0x02, 0x80, 0x8F,
+  0xE0, 0x38, 0x97, 0x00, 0x7F, 0xFC, 0x11, 0x82, 0x31, 0xF6, 0x00, 0xB0, 0x20, 0x71, 0x2E, 0x00,
+  0xFF, 0xF8, 0x22, 0x04, 0x43, 0xE8, 0x01, 0x00, 0x40, 0xE2, 0x58, 0xF8, 0x60, 0xD0, 0x06, 0x00,
+  0xC4, 0x17, 0x8E, 0x10, 0x02, 0x04, 0xB8, 0x03, 0xFF, 0xE1, 0x08, 0x20, 0x04, 0x10, 0x87, 0xFF,
+  0xC0, 0x11, 0x51, 0x2E, 0x00, 0xC0, 0x1F, 0xFF, 0x00, 0x60, 0x08, 0x38, 0x1B, 0x80, 0x08, 0x00,
+  0x40, 0x06, 0x00, 0x2F, 0xFF, 0x00, 0x08, 0x00, 0x41, 0xC4, 0xB8, 0x03, 0xFF, 0xE0, 0x88, 0x38,
+  0x98, 0xBC, 0x0E, 0x00, 0x83, 0x89, 0x70, 0x07, 0xFF, 0xC0, 0x18, 0x01, 0x00, 0x20, 0x06, 0x00,
+  0x07, 0x12, 0xE0, 0x0F, 0xFF, 0x03, 0xFF, 0x80, 0x0F, 0xFF, 0xF8, 0x02, 0x10, 0x25, 0xC0, 0x1F,
+  0xFF, 0x01, 0x80, 0xC0, 0xE0, 0x60, 0x3F, 0xFC, 0x00, 0x83, 0x89, 0x67, 0xF1, 0x01, 0x40, 0x18,
+  0x03, 0x00, 0x50, 0x11, 0xFC, 0x07, 0x12, 0xE0, 0x0F, 0xFF, 0x84, 0x20, 0x84, 0x10, 0x82, 0x10,
+  0x3C, 0x0E, 0x16, 0x0F, 0xE1, 0x81, 0x24, 0x0A, 0x40, 0xB8, 0x0D, 0x01, 0x4F, 0xE0, 0x40, 0x97,
+  0x00, 0x7F, 0xFC, 0x11, 0x02, 0x21, 0xC4, 0xC8, 0xE0, 0xE8, 0x00, 0x2C, 0x25, 0xF0, 0xE8, 0x23,
+  0x08, 0x61, 0x0C, 0x41, 0x70, 0xE0, 0xE2, 0x58, 0x03, 0x00, 0x30, 0x07, 0xFF, 0xC0, 0x10, 0x02,
+  0x00, 0xC2, 0x04, 0xB0, 0x02, 0xFF, 0xE0, 0x0C, 0x00, 0x80, 0x10, 0x05, 0xFF, 0x80, 0x10, 0x81,
+  0x2C, 0x00, 0x80, 0xF1, 0xE3, 0xC0, 0x0E, 0x00, 0x39, 0x00, 0xE0, 0x04, 0x1C, 0x4B, 0x0F, 0xFE,
+  0x04, 0x70, 0x01, 0xF1, 0xC1, 0xE0, 0x43, 0xF8, 0x40, 0x97, 0x00, 0x70, 0x1D, 0x8D, 0x0E, 0x01,
+  0xC2, 0xC6, 0xE0, 0x38, 0x02, 0x0E, 0x25, 0x80, 0x10, 0x0F, 0x06, 0x7F, 0x04, 0x19, 0x00, 0xE0,
+  0x04, 0x1C, 0x4B, 0x80, 0x5C, 0x06, 0x60, 0xC2, 0x18, 0x33, 0x01, 0xD8, 0x09, 0xA0, 0x5D, 0xFF,
+  0xFC, 0x00, 0x30, 0x00, 0xC0, 0x02, 0x2C, 0x07, 0x00, 0x06, 0x00, 0x60, 0x0E, 0x00, 0xC0, 0x1C,
+  0x01, 0x80, 0x00, 0xA0, 0x5D, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xFF, 0xFE, 0x4A, 0xD1, 0x4A, 0xC1,
+  0x00, 0x0F, 0xF8, 0x9B, 0x44, 0xB0, 0xB8, 0x8E, 0xCA, 0x4C, 0x58, 0xB1, 0x7F, 0x40, 0x07, 0x12,
+  0xC0, 0x0F, 0xFF, 0x44, 0x10, 0x42, 0x08, 0x22, 0x03, 0x80, 0x2C, 0x23, 0x9C, 0x45, 0x06, 0x0C,
+  0x14, 0x42, 0xE2, 0x59, 0xC0, 0x44, 0x10, 0x42, 0x08, 0x21, 0x1F, 0xFF, 0x00, 0x05, 0x84, 0x77,
+  0xD1, 0x62, 0xC5, 0x8A, 0x98, 0x5C, 0x4B, 0x82, 0x10, 0x43, 0xFF, 0x41, 0x18, 0x22, 0x04, 0x40,
+  0x18, 0xB0, 0x12, 0xD6, 0x94, 0xCA, 0x65, 0x32, 0x76, 0x08, 0x40, 0x97, 0x00, 0x7F, 0xFC, 0x20,
+  0x02, 0x00, 0x42, 0x08, 0x7E, 0x08, 0x00, 0x2A, 0x25, 0xC1, 0x08, 0x27, 0xFC, 0xE0, 0x04, 0x00,
+  0x15, 0x03, 0x70, 0x01, 0x00, 0x08, 0x08, 0x40, 0x4D, 0xFE, 0x60, 0xE2, 0x5C, 0x01, 0xFF, 0xF2,
+  0x00, 0x20, 0x5B, 0x0C, 0x21, 0x04, 0x05, 0x44, 0xB8, 0x03, 0x00, 0x7F, 0xFC, 0x00, 0x80, 0x01,
+  0x02, 0x3C, 0x1F, 0xF0, 0x40, 0xFF, 0x82, 0x07, 0xF0, 0x40, 0x8F, 0x07, 0xFC, 0x20, 0x20, 0x60,
+  0xFE, 0x80, 0x2C, 0x23, 0xBE, 0x83, 0x06, 0x0C, 0x17, 0xC0, 0xE0, 0x4C, 0x07, 0xFF, 0x42, 0x20,
+  0x90, 0x44, 0x41, 0xC1, 0x70, 0x24, 0x38, 0x22, 0x20, 0x90, 0x68, 0x3F, 0xF8, 0x00, 0x38, 0x8F,
+  0x06, 0x0F, 0xF8, 0x50, 0x40, 0x83, 0x16, 0x11, 0xF3, 0x49, 0x93, 0x26, 0x4B, 0x31, 0x51, 0x24,
+  0x08, 0x04, 0x7F, 0xC1, 0x20, 0x81, 0x02, 0x38, 0x17, 0xF0, 0x20, 0x40, 0x43, 0xFE, 0x00, 0x40,
+  0x8E, 0x04, 0x19, 0xDC, 0x04, 0x06, 0x83, 0x02, 0x10, 0x23, 0x9F, 0xC2, 0x60, 0x39, 0x8C, 0x27,
+  0xC0, 0x8B, 0x08, 0xF0, 0x71, 0xDC, 0x3B, 0x8E, 0x08, 0x40, 0x13, 0x01, 0x81, 0xC7, 0x5C, 0x03,
+  0x00, 0x68, 0x0C, 0x02, 0x2C, 0x23, 0xC3, 0xC3, 0x66, 0x2C, 0x3C, 0x28, 0x81, 0x70, 0x08, 0x0F,
+  0xDF, 0x40, 0x03, 0x00, 0x0A, 0x08, 0x21, 0xFF, 0xFE, 0x28, 0x17, 0x40, 0x03, 0x00, 0x0B, 0xF7,
+  0xC0, 0x20, 0x0B, 0xB4, 0x78, 0x94, 0xA4, 0x24, 0x49, 0x1A, 0x65, 0x80,
+};
+
+static const uint16_t epd_font16_r0_index[] = {
+  0, 514, 1003, 1664, 2207, 2978, 3752, 4541,
+  5141, 5709, 6347, 6921,
+};
+
+static const uint8_t epd_font24_r0_data[] = {
+  0x00, 0x00, 0x14, 0xC7, 0x1E, 0x00, 0xFF, 0x1F, 0xFF, 0x80, 0x3E, 0x53, 0x03, 0x40, 0xC1, 0x83,
+  0xC6, 0xC1, 0x83, 0x86, 0x34, 0x38, 0x06, 0x18, 0x7F, 0x98, 0x06, 0x7F, 0x86, 0x18, 0x06, 0x18,
+  0x06, 0x18, 0x06, 0x18, 0x7F, 0x98, 0x06, 0x7F, 0x86, 0x18, 0x14, 0x06, 0x81, 0xC0, 0xE0, 0x3C,
+  0x1F, 0x04, 0x03, 0x18, 0x40, 0x60, 0x9F, 0xFF, 0xFE, 0x41, 0xC0, 0x83, 0xF8, 0x78, 0x1E, 0x07,
+  0x01, 0x63, 0x80, 0x03, 0xE0, 0x0C, 0x1C, 0x08, 0x0B, 0x8C, 0x18, 0xE7, 0xE0, 0x1C, 0x01, 0xF7,
+  0x06, 0x0D, 0xC4, 0x04, 0x3E, 0x0C, 0x09, 0xF0, 0x00, 0x58, 0xE0, 0x78, 0x00, 0xFE, 0x01, 0x81,
+  0xFD, 0x03, 0x83, 0x0E, 0x82, 0xB8, 0x7E, 0x70, 0x3C, 0xDC, 0x41, 0x03, 0xC1, 0x00, 0x40, 0x80,
+  0x00, 0x29, 0x03, 0x41, 0x1A, 0x67, 0x2B, 0x06, 0xA0, 0x3F, 0x80, 0x07, 0xFF, 0x00, 0xF0, 0x1E,
+  0x0C, 0x00, 0x18, 0x80, 0x00, 0x28, 0x00, 0x00, 0x8B, 0x06, 0xB0, 0x00, 0x01, 0x40, 0x00, 0x11,
+  0x80, 0x03, 0x07, 0x80, 0xF0, 0x0F, 0xFE, 0x00, 0x1F, 0xC0, 0x0D, 0x99, 0x82, 0x10, 0x33, 0x03,
+  0x30, 0x1E, 0x00, 0xC1, 0xFF, 0xE0, 0xC0, 0x1E, 0x03, 0x30, 0x33, 0x02, 0x10, 0x36, 0x65, 0x82,
+  0x00, 0x40, 0x08, 0x01, 0x00, 0x20, 0xFF, 0xE0, 0x80, 0x10, 0x02, 0x00, 0x40, 0x08, 0x05, 0x00,
+  0x68, 0x23, 0x4C, 0xE1, 0xA5, 0x87, 0xFF, 0x23, 0x18, 0xFF, 0xE3, 0x41, 0xAE, 0x00, 0x00, 0x1C,
+  0x00, 0x00, 0x38, 0x00, 0x00, 0x30, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xC0, 0x00,
+  0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x06, 0x34, 0x38, 0x07, 0xF8, 0x1F, 0xFE, 0x38, 0x07, 0x60,
+  0x01, 0xC0, 0x00, 0xC0, 0x00, 0xE0, 0x01, 0xB8, 0x07, 0x1F, 0xFE, 0x07, 0xF8, 0x14, 0x0E, 0x10,
+  0x00, 0x90, 0x00, 0x90, 0x00, 0x9F, 0xFF, 0xDF, 0xFF, 0xF0, 0x00, 0x10, 0x00, 0x10, 0x00, 0x03,
+  0x23, 0x87, 0x00, 0xE6, 0x80, 0xD6, 0x40, 0x0E, 0x20, 0x0E, 0x10, 0x0E, 0x08, 0x0E, 0x0E, 0x1E,
+  0x07, 0xF7, 0xC1, 0xE0, 0xC8, 0xE0, 0x70, 0x38, 0xF0, 0x3D, 0x00, 0x03, 0x01, 0x03, 0x01, 0x03,
+  0x01, 0x87, 0x82, 0xFC, 0xFE, 0x78, 0x78, 0x00, 0x34, 0x38, 0x83, 0x00, 0x01, 0x60, 0x00, 0x88,
+  0x00, 0x43, 0x04, 0x20, 0x42, 0x10, 0x19, 0xFF, 0xFE, 0xFF, 0xFF, 0xC2, 0x00, 0x21, 0x00, 0x03,
+  0x23, 0x81, 0xC0, 0x02, 0xCF, 0xFC, 0x04, 0x1C, 0x02, 0x1C, 0x02, 0x1C, 0x02, 0x1F, 0x06, 0x1B,
+  0xFC, 0x18, 0xF8, 0x18, 0xD0, 0xE0, 0x1F, 0xC0, 0x7F, 0xF8, 0xC2, 0x1D, 0x81, 0x05, 0x00, 0x83,
+  0x00, 0x83, 0x00, 0x82, 0x81, 0x8E, 0xFF, 0x0C, 0x3E, 0x00, 0x52, 0x38, 0x00, 0x0F, 0x00, 0x03,
+  0x80, 0x01, 0xFC, 0x01, 0xFF, 0x81, 0x80, 0x61, 0x80, 0x1D, 0x80, 0x03, 0x80, 0x01, 0x8D, 0x0E,
+  0x07, 0x87, 0x8F, 0xEF, 0xC8, 0x2C, 0x70, 0x18, 0x30, 0x18, 0x30, 0x30, 0x30, 0x30, 0x38, 0x68,
+  0x6F, 0xCF, 0xC7, 0x83, 0x83, 0x43, 0x80, 0x07, 0xC3, 0x0F, 0xF7, 0x18, 0x34, 0x10, 0x0C, 0x10,
+  0x0C, 0x10, 0x0A, 0x08, 0x0B, 0xC4, 0x30, 0xFF, 0xE0, 0x3F, 0x82, 0x98, 0xD9, 0xC0, 0xFC, 0x0F,
+  0xC0, 0xEA, 0x41, 0x6D, 0x80, 0xDC, 0x06, 0x52, 0x38, 0x80, 0x40, 0x00, 0x50, 0x00, 0x44, 0x00,
+  0x41, 0x00, 0x40, 0x40, 0x40, 0x10, 0x40, 0x04, 0x40, 0x01, 0x40, 0x00, 0x46, 0x90, 0x68, 0x61,
+  0x86, 0x18, 0x61, 0x86, 0x18, 0x61, 0x29, 0x1C, 0x60, 0x00, 0x28, 0x00, 0x22, 0x00, 0x20, 0x80,
+  0x20, 0x20, 0x20, 0x08, 0x20, 0x02, 0x20, 0x00, 0xA0, 0x00, 0x20, 0x03, 0x43, 0x88, 0x00, 0xF0,
+  0x00, 0x64, 0x00, 0x02, 0xE0, 0x00, 0xF3, 0xC0, 0x78, 0x20, 0x20, 0x08, 0x10, 0x06, 0x18, 0x01,
+  0xF8, 0x00, 0x78, 0x36, 0x38, 0x07, 0xF0, 0x1F, 0xFC, 0x38, 0x07, 0x23, 0xC1, 0x44, 0x39, 0xC4,
+  0x0C, 0xC3, 0x04, 0xC7, 0xF8, 0xA4, 0x0D, 0x12, 0x03, 0x09, 0xFC, 0x06, 0x0E, 0x10, 0x00, 0x18,
+  0x00, 0x1F, 0x80, 0x10, 0x7C, 0x00, 0x43, 0x80, 0x40, 0xE0, 0x47, 0xE0, 0x7F, 0x13, 0xF8, 0x1F,
+  0x80, 0x1C, 0x00, 0x10, 0x00, 0x01, 0x63, 0x84, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x04, 0x0C,
+  0x04, 0x0C, 0x04, 0x0C, 0x04, 0x0C, 0x06, 0x1E, 0x0B, 0xF3, 0xF9, 0xE1, 0xE0, 0x00, 0xD0, 0xE0,
+  0x1F, 0xC0, 0x7F, 0xF8, 0xE0, 0x1D, 0x80, 0x05, 0x00, 0x03, 0x00, 0x03, 0x00, 0x02, 0x80, 0x02,
+  0x40, 0x06, 0x30, 0x1E, 0x16, 0x38, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xC0, 0x00,
+  0xC0, 0x00, 0xE0, 0x00, 0xA0, 0x01, 0x38, 0x07, 0x1F, 0xFE, 0x07, 0xF8, 0x05, 0x8E, 0x10, 0x00,
+  0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x10, 0x30, 0x10, 0x30, 0x10, 0x30, 0x10, 0x30, 0x7C, 0x30, 0x00,
+  0x38, 0x00, 0x66, 0x00, 0x81, 0x63, 0x84, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x04, 0x08, 0x04,
+  0x08, 0x04, 0x08, 0x04, 0x08, 0x1F, 0x08, 0x00, 0x18, 0x00, 0x18, 0x00, 0x60, 0xD8, 0xE0, 0x1F,
+  0xC0, 0x7F, 0xF8, 0xE0, 0x1D, 0x80, 0x07, 0x00, 0x03, 0x04, 0x03, 0x04, 0x02, 0xFC, 0x04, 0xFC,
+  0x1E, 0x04, 0x00, 0x04, 0x00, 0x18, 0x38, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x40, 0x80,
+  0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x40, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x94,
+  0x0E, 0x10, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x30, 0x00, 0x30,
+  0x00, 0x23, 0x60, 0x9B, 0x00, 0x00, 0xE0, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0xC0, 0x00, 0x1C,
+  0x00, 0x02, 0xFF, 0xFF, 0xCF, 0xFF, 0xF8, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x04, 0x30, 0x70,
+  0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x81, 0x00, 0xC0, 0x03, 0xE0, 0x0F, 0x19, 0x9E, 0x05,
+  0xF8, 0x03, 0xE0, 0x01, 0xC0, 0x01, 0x80, 0x00, 0x0B, 0x1C, 0x20, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xE0, 0x00, 0x60, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x30, 0x00, 0x0C, 0x00,
+  0x03, 0x07, 0x08, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0xF0, 0x1F, 0xF1, 0xFF, 0x0F, 0xE0, 0x01, 0xF0,
+  0x00, 0x0F, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x10, 0xC1, 0xC2, 0x00, 0x07, 0xFF,
+  0xFE, 0x00, 0x1C, 0x00, 0x78, 0x00, 0xE0, 0x03, 0x80, 0x0F, 0x00, 0x1C, 0x00, 0x70, 0x01, 0xE0,
+  0x07, 0xFF, 0xFC, 0x00, 0x04, 0x68, 0x70, 0x0F, 0xF0, 0x3F, 0xFC, 0x70, 0x0E, 0xC0, 0x03, 0x80,
+  0x01, 0x80, 0x01, 0xC0, 0x03, 0x60, 0x06, 0x3F, 0xFC, 0x0F, 0xF0, 0x0B, 0x1C, 0x20, 0x00, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xE0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x60, 0xC0,
+  0x3F, 0x80, 0x1F, 0x06, 0x83, 0x20, 0x3F, 0xC0, 0x3F, 0xFC, 0x1C, 0x03, 0x88, 0x80, 0x32, 0x20,
+  0x04, 0x98, 0x01, 0x78, 0x00, 0xFE, 0x00, 0x6C, 0xFF, 0xF1, 0x0F, 0xF0, 0x0C, 0x1C, 0x20, 0x00,
+  0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x20, 0x40, 0x20, 0x40, 0x60, 0x41, 0xE0, 0x47, 0xA0, 0x5E, 0x10,
+  0xF8, 0x1F, 0xA0, 0x0F, 0x20, 0x00, 0x06, 0x87, 0x0F, 0x83, 0xC6, 0x07, 0xE4, 0x06, 0x38, 0x0C,
+  0x18, 0x0C, 0x18, 0x18, 0x18, 0x18, 0x1C, 0x30, 0x27, 0xF0, 0x23, 0xC0, 0xF0, 0xC1, 0xC0, 0x00,
+  0x30, 0x00, 0x0C, 0x00, 0x04, 0x00, 0x06, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x04, 0x00,
+  0x04, 0x00, 0x04, 0x00, 0x0C, 0x00, 0x30, 0x30, 0x70, 0x00, 0x01, 0x3F, 0xFF, 0x7F, 0xFF, 0xC0,
+  0x01, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x40, 0x01, 0x3F, 0xFF, 0x00,
+  0x01, 0x0C, 0x1C, 0x00, 0x00, 0x40, 0x00, 0xC0, 0x0F, 0xC0, 0xFF, 0xCF, 0xF0, 0x7F, 0x00, 0x38,
+  0x00, 0x0F, 0x00, 0x00, 0xF8, 0x40, 0x07, 0xC0, 0x00, 0xC0, 0x00, 0x43, 0x07, 0x00, 0x00, 0x10,
+  0x03, 0xF1, 0xFF, 0xFF, 0xFC, 0x11, 0xF0, 0x00, 0x0F, 0xF0, 0xFF, 0xFF, 0xFE, 0x11, 0xF0, 0x00,
+  0x0F, 0x90, 0x00, 0x70, 0x00, 0x11, 0xA1, 0xC2, 0x00, 0x07, 0x00, 0x0F, 0xC0, 0x7E, 0x71, 0xF4,
+  0x0F, 0x80, 0x3F, 0x02, 0xF8, 0xC7, 0xE0, 0x3F, 0x00, 0x0E, 0x00, 0x04, 0x30, 0x70, 0x00, 0x01,
+  0x00, 0x03, 0x00, 0x0F, 0x80, 0x3F, 0x81, 0xF1, 0xFF, 0xC0, 0xFF, 0x00, 0x80, 0xC0, 0x80, 0x39,
+  0x00, 0x07, 0x00, 0x03, 0x00, 0x01, 0x1A, 0x1C, 0x20, 0x01, 0x38, 0x00, 0xFE, 0x00, 0x6F, 0x80,
+  0x61, 0xE0, 0x60, 0x7C, 0x60, 0x1F, 0x60, 0x07, 0xF0, 0x01, 0xCC, 0x00, 0x55, 0x83, 0x5F, 0xFF,
+  0xFF, 0xC0, 0x00, 0x06, 0x00, 0x00, 0x30, 0x00, 0x01, 0x80, 0x00, 0x0C, 0x00, 0x00, 0x4A, 0x41,
+  0x40, 0x00, 0x01, 0x00, 0x00, 0xE0, 0x00, 0x30, 0x00, 0x1C, 0x00, 0x06, 0x00, 0x03, 0x80, 0x00,
+  0xC0, 0x00, 0x70, 0x00, 0x08, 0x00, 0x00, 0x26, 0x0D, 0x60, 0x00, 0x03, 0x00, 0x00, 0x18, 0x00,
+  0x00, 0xC0, 0x00, 0x06, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x37, 0x98, 0xE2, 0x65, 0xA8, 0x18, 0x00,
+  0xFF, 0xF9, 0xA5, 0x04, 0xB4, 0x36, 0x35, 0xBC, 0x0F, 0xCD, 0x8D, 0xA0, 0x8C, 0x19, 0x81, 0x28,
+  0x27, 0xFF, 0xFF, 0xE8, 0x01, 0x80, 0x06, 0x87, 0x10, 0x00, 0x17, 0xFF, 0xF9, 0xFF, 0xFF, 0x81,
+  0x80, 0x80, 0x40, 0x40, 0x10, 0x20, 0x08, 0x18, 0x0C, 0x07, 0xFC, 0x00, 0xFC, 0x00, 0x64, 0x6B,
+  0x1F, 0x0F, 0xF9, 0x83, 0x40, 0x18, 0x03, 0x00, 0x60, 0x7A, 0x0E, 0x30, 0x03, 0x43, 0x88, 0xF8,
+  0x01, 0xFF, 0x01, 0x81, 0xC0, 0x80, 0x20, 0x40, 0x10, 0x20, 0x08, 0x08, 0x08, 0x2F, 0xFF, 0xF3,
+  0xFF, 0xFD, 0x00, 0x00, 0x52, 0x35, 0x8F, 0x87, 0xFC, 0xC4, 0xB0, 0x8C, 0x11, 0x82, 0x30, 0x4D,
+  0x0F, 0x11, 0xC1, 0xA1, 0xC0, 0x00, 0x82, 0x00, 0x82, 0x00, 0x83, 0xFF, 0xF3, 0xFF, 0xFA, 0x00,
+  0x8E, 0x00, 0x86, 0x00, 0x84, 0x00, 0x9C, 0x00, 0x18, 0x6C, 0x0E, 0x70, 0x01, 0xD9, 0xCC, 0xFF,
+  0xA3, 0x63, 0x8D, 0x06, 0x34, 0x18, 0x98, 0xF2, 0x3E, 0x78, 0x75, 0xC0, 0x10, 0x00, 0xC6, 0x87,
+  0x18, 0x00, 0x17, 0xFF, 0xFB, 0xFF, 0xFF, 0x00, 0x80, 0x00, 0x20, 0x00, 0x10, 0x20, 0x08, 0x1F,
+  0xFC, 0x0F, 0xFC, 0x04, 0x00, 0x00, 0xA0, 0x70, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0xFF, 0xE3,
+  0xFF, 0xE3, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x27, 0x04, 0xF0, 0x00, 0x06, 0x00, 0x00, 0x80,
+  0x04, 0x10, 0x00, 0x83, 0x00, 0x10, 0x3F, 0xFE, 0x33, 0xFF, 0xC6, 0x34, 0x38, 0xC0, 0x00, 0xBF,
+  0xFF, 0xDF, 0xFF, 0xF8, 0xC0, 0x00, 0x30, 0x00, 0x7E, 0x81, 0xF1, 0xC0, 0xE0, 0x20, 0x40, 0x10,
+  0x20, 0x00, 0x05, 0x03, 0x8C, 0x00, 0x0A, 0x00, 0x05, 0x00, 0x02, 0xFF, 0xFF, 0x7F, 0xFF, 0xE0,
+  0x00, 0x10, 0x00, 0x08, 0x00, 0x00, 0x60, 0xD7, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x40, 0x07, 0xFF,
+  0xFF, 0xF8, 0x04, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x03, 0x43, 0x5C, 0x01, 0xFF, 0xFF, 0xFE, 0x01,
+  0x00, 0x20, 0x03, 0x00, 0x7F, 0xFF, 0xFE, 0x80, 0x03, 0x43, 0x58, 0xF8, 0x7F, 0x8C, 0x1A, 0x01,
+  0xC0, 0x18, 0x03, 0x00, 0xD8, 0x33, 0xFC, 0x1F, 0x03, 0x40, 0x74, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
+  0x10, 0x14, 0x80, 0x22, 0x00, 0x88, 0x02, 0x38, 0x18, 0x7F, 0xC0, 0x7E, 0x0D, 0x01, 0xC0, 0x7C,
+  0x07, 0xFC, 0x30, 0x38, 0x80, 0x22, 0x00, 0xC8, 0x03, 0x10, 0x17, 0xFF, 0xDF, 0xFF, 0xC0, 0x00,
+  0x16, 0x35, 0xC0, 0x18, 0x03, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x90, 0x0A, 0x00, 0x80, 0x10, 0x06,
+  0x00, 0xCA, 0x46, 0xBF, 0x19, 0x87, 0xA1, 0x9C, 0x31, 0x84, 0x31, 0x87, 0x30, 0xBC, 0x33, 0x0E,
+  0x32, 0x37, 0x80, 0x10, 0x00, 0x20, 0x00, 0x41, 0xFF, 0xE7, 0xFF, 0xF8, 0x02, 0x10, 0x04, 0x20,
+  0x08, 0x30, 0x00, 0x1A, 0x1B, 0x00, 0x09, 0xFF, 0xBF, 0xFF, 0x00, 0x20, 0x02, 0x00, 0x10, 0x0B,
+  0xFF, 0x9F, 0xFD, 0x00, 0x06, 0xC6, 0xB0, 0x02, 0x00, 0xC0, 0x78, 0x7F, 0x7E, 0x3E, 0x01, 0xC0,
+  0x07, 0x10, 0x1E, 0x00, 0xC0, 0x08, 0x60, 0xD6, 0x00, 0x40, 0x79, 0xFF, 0xFE, 0x27, 0x00, 0x1C,
+  0x81, 0xF3, 0xFF, 0xF8, 0x4F, 0x00, 0x1F, 0x00, 0x23, 0x43, 0x5C, 0x01, 0x80, 0x3C, 0x1E, 0xCF,
+  0x87, 0x99, 0xE1, 0xF3, 0x78, 0x3E, 0x01, 0x80, 0x23, 0x40, 0x70, 0x00, 0x38, 0x01, 0xC0, 0x1F,
+  0x83, 0xF9, 0xBE, 0x21, 0xC0, 0x00, 0xE2, 0x00, 0x78, 0x00, 0x20, 0x00, 0x94, 0x8D, 0x70, 0x1F,
+  0x80, 0xFC, 0x1B, 0xE3, 0x1F, 0x60, 0xFC, 0x07, 0xC0, 0x2E, 0x01, 0x54, 0x35, 0x00, 0x20, 0x00,
+  0x02, 0x80, 0x1F, 0xF7, 0xFD, 0x80, 0x00, 0x38, 0x00, 0x00, 0xB0, 0x83, 0x1F, 0xFF, 0xFF, 0xE4,
+  0xA1, 0xAC, 0x00, 0x00, 0x70, 0x00, 0x06, 0xFF, 0xBF, 0xE0, 0x05, 0x00, 0x00, 0x10, 0x00, 0x6E,
+  0x45, 0x60, 0xC2, 0x11, 0x11, 0x10, 0x86, 0x08, 0x4C, 0xD3, 0x18, 0x94, 0x30, 0xA4, 0x60,
+};
+
+static const uint16_t epd_font24_r0_index[] = {
+  0, 945, 1847, 3185, 4247, 5799, 7384, 9004,
+  10125, 11250, 12483, 13635,
+};
+
+const EPD_FONT epd_fonts[] = {
+  { 8, 6, 8, 0, 6, 8, 3, 4, 32, 96, epd_font8_r0_index, epd_font8_r0_data,
+    epd_font8_metrics, epd_font8_kern, 29 },
+  { 12, 6, 16, 0, 6, 16, 3, 5, 32, 96, epd_font12_r0_index, epd_font12_r0_data,
+    epd_font12_metrics, epd_font12_kern, 54 },
+  { 16, 8, 16, 0, 8, 16, 4, 5, 32, 96, epd_font16_r0_index, epd_font16_r0_data,
+    epd_font16_metrics, epd_font16_kern, 51 },
+  { 24, 12, 24, 0, 12, 24, 4, 5, 32, 96, epd_font24_r0_index, epd_font24_r0_data,
+    epd_font24_metrics, epd_font24_kern, 54 },
+  { 0 },
+};
+
+#ifdef EPD_FONT_CJK
+
+const unsigned char Hzk1[][32] = {
+  {
+    0x00, 0x00, 0xF0, 0x10, 0x10, 0x10, 0x10, 0xFF, 0x10, 0x10, 0x10, 0x10, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0x04, 0x04, 0x04, 0x04, 0xFF, 0x04, 0x04, 0x04, 0x04, 0x0F, 0x00, 0x00, 0x00,
+  },
+  {
+    0x40, 0x40, 0x40, 0x5F, 0x55, 0x55, 0x55, 0x75, 0x55, 0x55, 0x55, 0x5F, 0x40, 0x40, 0x40, 0x00,
+    0x00, 0x40, 0x20, 0x0F, 0x09, 0x49, 0x89, 0x79, 0x09, 0x09, 0x09, 0x0F, 0x20, 0x40, 0x00, 0x00,
+  },
+  {
+    0x00, 0xFE, 0x02, 0x42, 0x4A, 0xCA, 0x4A, 0x4A, 0xCA, 0x4A, 0x4A, 0x42, 0x02, 0xFE, 0x00, 0x00,
+    0x00, 0xFF, 0x40, 0x50, 0x4C, 0x43, 0x40, 0x40, 0x4F, 0x50, 0x50, 0x5C, 0x40, 0xFF, 0x00, 0x00,
+  },
+  {
+    0x00, 0x00, 0xF8, 0x88, 0x88, 0x88, 0x88, 0xFF, 0x88, 0x88, 0x88, 0x88, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0x08, 0x08, 0x08, 0x08, 0x7F, 0x88, 0x88, 0x88, 0x88, 0x9F, 0x80, 0xF0, 0x00,
+  },
+  {
+    0x80, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0xE2, 0xA2, 0x92, 0x8A, 0x86, 0x82, 0x80, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {
+    0x10, 0x10, 0x10, 0xFF, 0x10, 0x90, 0x08, 0x88, 0x88, 0x88, 0xFF, 0x88, 0x88, 0x88, 0x08, 0x00,
+    0x04, 0x44, 0x82, 0x7F, 0x01, 0x80, 0x80, 0x40, 0x43, 0x2C, 0x10, 0x28, 0x46, 0x81, 0x80, 0x00,
+  },
+  {
+    0x00, 0x10, 0x10, 0x10, 0x10, 0xD0, 0x30, 0xFF, 0x30, 0xD0, 0x12, 0x1C, 0x10, 0x10, 0x00, 0x00,
+    0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00,
+  },
+  {
+    0x04, 0x04, 0x04, 0x84, 0xE4, 0x3C, 0x27, 0x24, 0x24, 0x24, 0x24, 0xE4, 0x04, 0x04, 0x04, 0x00,
+    0x04, 0x02, 0x01, 0x00, 0xFF, 0x09, 0x09, 0x09, 0x09, 0x49, 0x89, 0x7F, 0x00, 0x00, 0x00, 0x00,
+  },
+  {
+    0x00, 0xFE, 0x22, 0x5A, 0x86, 0x00, 0xFE, 0x92, 0x92, 0x92, 0x92, 0x92, 0xFE, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x04, 0x08, 0x07, 0x00, 0xFF, 0x40, 0x20, 0x03, 0x0C, 0x14, 0x22, 0x41, 0x40, 0x00,
+  },
+  {
+    0x00, 0x80, 0x40, 0x20, 0x18, 0x06, 0x80, 0x00, 0x07, 0x18, 0x20, 0x40, 0x80, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x20, 0x70, 0x28, 0x26, 0x21, 0x20, 0x20, 0x24, 0x38, 0x60, 0x00, 0x01, 0x01, 0x00,
+  },
+  {
+    0x00, 0x10, 0x12, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x12, 0x12, 0x02, 0xFE, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0x10, 0x10, 0x10, 0x10, 0x3F, 0x00, 0x40, 0x80, 0x7F, 0x00, 0x00, 0x00,
+  },
+};
+
+const unsigned char Hzk2[][72] = {
+  {
+    0x00, 0x00, 0x00, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFC, 0x84, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0xFF, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xFF, 0x7F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+};
+
+const unsigned char Hzk3[][128] = {
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xFF,
+    0xFF, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0xFF,
+    0xFF, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+};
+
+const unsigned char Hzk4[][512] = {
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF0,
+    0xF0, 0x70, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x06, 0x06, 0x06, 0x06,
+    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+    0x06, 0x06, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x0F,
+    0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+};
+
+#endif
@@ -0,0 +1,101 @@
+/*
+ * epdprof.c
+ *
+ * Ring of EPD_PROF_RECORDS update records. Work is summed into an open
+ * record, which goes into the ring when the next update command is sent;
+ * the waveform time and the wait for it are added to that ring entry later.
+ */
+
+#include "epdprof.h"
+
+#ifdef EPD_PROFILE
+
+#include <stdio.h>
+#include <string.h>
+
+static EPD_PROF_RECORD _epd_prof_ring[EPD_PROF_RECORDS];
+static EPD_PROF_RECORD _epd_prof_open;
+static uint32_t _epd_prof_count; // records written, the ring keeps the last ones
+static EPD_PROF_RECORD *_epd_prof_last = NULL;
+static uint32_t _epd_prof_sent; // DWT->CYCCNT at the update command
+static uint32_t _epd_prof_dumped; // _epd_prof_count at the last dump
+
+void epd_prof_init(void) {
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  memset(&_epd_prof_open, 0, sizeof(_epd_prof_open));
+  _epd_prof_count = 0;
+  _epd_prof_dumped = 0;
+  _epd_prof_last = NULL;
+}
+
+void epd_prof_add(uint8_t stage, uint32_t cycles, uint32_t bytes) {
+  EPD_PROF_RECORD *r = &_epd_prof_open;
+
+  switch (stage) {
+  case EPD_PROF_RENDER:
+    r->Render += cycles;
+    break;
+  case EPD_PROF_SPI:
+    r->Spi += cycles;
+    r->Bytes += bytes;
+    break;
+  case EPD_PROF_UPDATE:
+    if (_epd_prof_last != NULL) r = _epd_prof_last;
+    r->Wait += cycles;
+    break;
+  default:
+    r->Wait += cycles;
+    break;
+  }
+}
+
+void epd_prof_update(uint8_t mode) {
+  EPD_PROF_RECORD *r = &_epd_prof_ring[_epd_prof_count % EPD_PROF_RECORDS];
+
+  _epd_prof_open.Tick = HAL_GetTick();
+  _epd_prof_open.Mode = mode;
+  *r = _epd_prof_open;
+  memset(&_epd_prof_open, 0, sizeof(_epd_prof_open));
+  _epd_prof_count++;
+  _epd_prof_last = r;
+  _epd_prof_sent = DWT->CYCCNT;
+}
+
+// from the BUSY falling edge
+void epd_prof_done(void) {
+  if (_epd_prof_last != NULL && !_epd_prof_last->Waveform) {
+    _epd_prof_last->Waveform = DWT->CYCCNT - _epd_prof_sent;
+  }
+}
+
+static void _epd_prof_print(UART_HandleTypeDef *huart, const char *line, int n) {
+  if (n > 0) HAL_UART_Transmit(huart, (uint8_t*) line, n, 100);
+}
+
+void epd_prof_dump(UART_HandleTypeDef *huart) {
+  const EPD_PROF_RECORD *r;
+  uint32_t i, n;
+  char line[128];
+
+  n = _epd_prof_count < EPD_PROF_RECORDS ? _epd_prof_count : EPD_PROF_RECORDS;
+  _epd_prof_print(huart, line, snprintf(line, sizeof(line),
+      "epd profile, %lu Hz, %lu of %lu updates\r\n"
+      "tick mode render spi wait waveform bytes\r\n", (unsigned long) SystemCoreClock,
+      (unsigned long) n, (unsigned long) _epd_prof_count));
+  for (i = _epd_prof_count - n; i != _epd_prof_count; i++) {
+    r = &_epd_prof_ring[i % EPD_PROF_RECORDS];
+    _epd_prof_print(huart, line, snprintf(line, sizeof(line), "%lu %02X %lu %lu %lu %lu %lu\r\n",
+        (unsigned long) r->Tick, r->Mode, (unsigned long) r->Render, (unsigned long) r->Spi,
+        (unsigned long) r->Wait, (unsigned long) r->Waveform, (unsigned long) r->Bytes));
+  }
+  _epd_prof_dumped = _epd_prof_count;
+}
+
+void epd_prof_poll(UART_HandleTypeDef *huart) {
+  if (_epd_prof_count - _epd_prof_dumped >= EPD_PROF_RECORDS) epd_prof_dump(huart);
+}
+
+#endif
@@ -0,0 +1,119 @@
+/*
+ * epdrefresh.c
+ *
+ * Decides between partial (0xCC, RAM LUT) and full (0xF7) updates. Every
+ * partial update is charged to the regions of the rows it changes, with
+ * the dirty width of those rows as the upper bound of the pixels that
+ * changed; a full refresh runs only once a region is over its budget, and
+ * clears them all.
+ */
+
+#include <string.h>
+#include "epdrefresh.h"
+
+#define EPD_REFRESH_ROWS ((EPD_H + EPD_REFRESH_REGIONS - 1) / EPD_REFRESH_REGIONS)
+
+static uint8_t _epd_partials[EPD_REFRESH_REGIONS];
+static uint32_t _epd_area[EPD_REFRESH_REGIONS];
+static uint8_t _epd_full_pending = 1; // panel content unknown after power on
+static uint8_t _epd_pending;
+static uint32_t _epd_pending_since;
+
+void epd_refresh_init(void) {
+  memset(_epd_partials, 0, sizeof(_epd_partials));
+  memset(_epd_area, 0, sizeof(_epd_area));
+  _epd_full_pending = 1;
+  _epd_pending = 0;
+}
+
+void epd_refresh_force_full(void) {
+  _epd_full_pending = 1;
+}
+
+// rows of EPD_Paint in ystart..yend that differ from the panel RAM, per
+// region; rows the driver will skip cost nothing. 0 if no row changed
+static uint8_t _epd_refresh_changed(uint16_t ystart, uint16_t yend, uint16_t *rows) {
+  uint16_t y;
+  uint8_t changed = 0;
+
+  memset(rows, 0, EPD_REFRESH_REGIONS * sizeof(rows[0]));
+  for (y = ystart; y <= yend; y++) {
+    if (epd_row_changed(EPD_Paint.Image, y)) {
+      rows[y / EPD_REFRESH_ROWS]++;
+      changed = 1;
+    }
+  }
+  return changed;
+}
+
+// with charge == 0: 1 if a partial update of the changed rows, width
+// pixels wide, keeps every region it touches within budget;
+// with charge == 1: book that update
+static uint8_t _epd_refresh_regions(const uint16_t *rows, uint16_t width, uint8_t charge) {
+  uint8_t r;
+  uint32_t area;
+
+  for (r = 0; r < EPD_REFRESH_REGIONS; r++) {
+    if (!rows[r]) continue;
+    area = (uint32_t) rows[r] * width;
+    if (charge) {
+      _epd_partials[r]++;
+      _epd_area[r] += area;
+    }
+    else if (_epd_partials[r] >= EPD_REFRESH_MAX_PARTIAL
+        || _epd_area[r] + area > (uint32_t) EPD_REFRESH_MAX_AREA * EPD_REFRESH_ROWS * EPD_W) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+// send the pending changes now, as a partial update when the budget allows
+uint8_t epd_refresh_now(void) {
+  uint16_t ystart = EPD_Paint.DirtyYStart, yend = EPD_Paint.DirtyYEnd;
+  uint16_t width = EPD_Paint.DirtyXEnd - EPD_Paint.DirtyXStart + 1;
+  uint16_t rows[EPD_REFRESH_REGIONS];
+
+  _epd_pending = 0;
+  // a partial update needs the old image in the controller RAM
+  if (!epd_ram_retained()) _epd_full_pending = 1;
+  if (!_epd_full_pending) {
+    if (!epd_paint_isdirty()) return EPD_REFRESH_NONE;
+    if (yend >= EPD_H) yend = EPD_H - 1;
+    // a dirty area without a changed row, as after epd_paint_selectimage()
+    // of an identical frame, does not wake the panel
+    if (!_epd_refresh_changed(ystart, yend, rows)) {
+      epd_paint_cleardirty();
+      return EPD_REFRESH_NONE;
+    }
+    _epd_full_pending = !_epd_refresh_regions(rows, width, 0);
+  }
+
+  if (epd_init()) return EPD_REFRESH_NONE;
+  if (_epd_full_pending) {
+    epd_displayBW_async(0);
+    _epd_full_pending = 0;
+    memset(_epd_partials, 0, sizeof(_epd_partials));
+    memset(_epd_area, 0, sizeof(_epd_area));
+    return EPD_REFRESH_FULL;
+  }
+
+  if (!epd_displayBW_async(1)) return EPD_REFRESH_NONE;
+  _epd_refresh_regions(rows, width, 1);
+  return EPD_REFRESH_PARTIAL;
+}
+
+// call from the main loop: changes are batched for EPD_REFRESH_BATCH_MS
+// after the first one, then sent as one update window
+uint8_t epd_refresh_poll(void) {
+  if (!epd_paint_isdirty() && !_epd_full_pending) {
+    _epd_pending = 0;
+    return EPD_REFRESH_NONE;
+  }
+  if (!_epd_pending) {
+    _epd_pending = 1;
+    _epd_pending_since = HAL_GetTick();
+  }
+  if (HAL_GetTick() - _epd_pending_since < EPD_REFRESH_BATCH_MS) return EPD_REFRESH_NONE;
+  return epd_refresh_now();
+}
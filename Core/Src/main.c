@@ -23,7 +23,9 @@
 /* USER CODE BEGIN Includes */
 #include "stdio.h"
 #include "display.h"
+#include "epaper.h"
 #include "bmp280.h"
+#include "epdprof.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -47,6 +49,7 @@ I2C_HandleTypeDef hi2c1;
 
 SPI_HandleTypeDef hspi1;
 SPI_HandleTypeDef hspi2;
+DMA_HandleTypeDef hdma_spi1_tx;
 
 UART_HandleTypeDef huart1;
 
@@ -57,6 +60,7 @@ UART_HandleTypeDef huart1;
 /* Private function prototypes -----------------------------------------------*/
 void SystemClock_Config(void);
 static void MX_GPIO_Init(void);
+static void MX_DMA_Init(void);
 static void MX_I2C1_Init(void);
 static void MX_SPI1_Init(void);
 static void MX_USART1_UART_Init(void);
@@ -101,12 +105,14 @@ int main(void) {
 
   /* Initialize all configured peripherals */
   MX_GPIO_Init();
+  MX_DMA_Init();
   MX_I2C1_Init();
   MX_SPI1_Init();
   MX_USART1_UART_Init();
   MX_SPI2_Init();
   MX_ADC_Init();
   /* USER CODE BEGIN 2 */
+  epd_prof_init();
 
   /* USER CODE END 2 */
 
@@ -116,7 +122,7 @@ int main(void) {
 
 
   while (1) {
-
+    epd_prof_poll(&huart1);
 
     /* USER CODE END WHILE */
 
@@ -351,6 +357,21 @@ static void MX_USART1_UART_Init(void) {
 
 }
 
+/**
+ * Enable DMA controller clock
+ */
+static void MX_DMA_Init(void) {
+
+  /* DMA controller clock enable */
+  __HAL_RCC_DMA1_CLK_ENABLE();
+
+  /* DMA interrupt init */
+  /* DMA1_Channel3_IRQn interrupt configuration */
+  HAL_NVIC_SetPriority(DMA1_Channel3_IRQn, 0, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Channel3_IRQn);
+
+}
+
 /**
  * @brief GPIO Initialization Function
  * @param None
@@ -375,7 +396,7 @@ static void MX_GPIO_Init(void) {
 
   /*Configure GPIO pin : DISP_BUSY_Pin */
   GPIO_InitStruct.Pin = DISP_BUSY_Pin;
-  GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
+  GPIO_InitStruct.Mode = GPIO_MODE_IT_FALLING;
   GPIO_InitStruct.Pull = GPIO_NOPULL;
   HAL_GPIO_Init(DISP_BUSY_GPIO_Port, &GPIO_InitStruct);
 
@@ -406,9 +427,16 @@ static void MX_GPIO_Init(void) {
   GPIO_InitStruct.Pull = GPIO_NOPULL;
   HAL_GPIO_Init(BTN_4_GPIO_Port, &GPIO_InitStruct);
 
+  /* EXTI interrupt init*/
+  HAL_NVIC_SetPriority(EXTI15_10_IRQn, 0, 0);
+  HAL_NVIC_EnableIRQ(EXTI15_10_IRQn);
+
 }
 
 /* USER CODE BEGIN 4 */
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin) {
+  if (GPIO_Pin == DISP_BUSY_Pin) epd_busy_irq();
+}
 
 /* USER CODE END 4 */
 
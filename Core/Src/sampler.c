@@ -0,0 +1,156 @@
+/*
+ * sampler.c
+ *
+ * A forced conversion is started by writing ctrl_meas alone, the MCU
+ * sleeps for the datasheet maximum of the conversion and then status and
+ * data come in one burst from 0xF3. The sensor drops back to sleep mode by
+ * itself when the conversion is done.
+ */
+
+#include "sampler.h"
+
+#define SAMPLER_WUT_HZ (SAMPLER_LSI_HZ / 2)
+#define SAMPLER_BURST (BMP280_TEMP_XLSB_ADDR - BMP280_STATUS_ADDR + 1)
+
+static volatile uint8_t _sampler_woken = 0;
+
+static void _sampler_rtc_unlock(void) {
+  RTC->WPR = 0xCA;
+  RTC->WPR = 0x53;
+}
+
+static void _sampler_rtc_lock(void) {
+  RTC->WPR = 0xFF;
+}
+
+// the RTC HAL module is not part of this build, the few registers the
+// wakeup timer needs are set here
+static void _sampler_rtc_init(void) {
+  __HAL_RCC_PWR_CLK_ENABLE();
+  HAL_PWR_EnableBkUpAccess();
+
+  RCC->CSR |= RCC_CSR_LSION;
+  while (!(RCC->CSR & RCC_CSR_LSIRDY));
+  // RTCSEL only changes after a backup domain reset
+  if ((RCC->CSR & RCC_CSR_RTCSEL) != RCC_CSR_RTCSEL_LSI) {
+    RCC->CSR |= RCC_CSR_RTCRST;
+    RCC->CSR &= ~RCC_CSR_RTCRST;
+    RCC->CSR |= RCC_CSR_RTCSEL_LSI;
+  }
+  RCC->CSR |= RCC_CSR_RTCEN;
+
+  _sampler_rtc_unlock();
+  RTC->CR &= ~(RTC_CR_WUTE | RTC_CR_WUTIE);
+  while (!(RTC->ISR & RTC_ISR_WUTWF));
+  RTC->CR = (RTC->CR & ~RTC_CR_WUCKSEL) | RTC_CR_WUCKSEL_1 | RTC_CR_WUCKSEL_0;
+  _sampler_rtc_lock();
+
+  // the wakeup timer is EXTI line 20, rising edge
+  EXTI->IMR |= EXTI_IMR_MR20;
+  EXTI->RTSR |= EXTI_RTSR_TR20;
+  HAL_NVIC_SetPriority(RTC_WKUP_IRQn, 0, 0);
+  HAL_NVIC_EnableIRQ(RTC_WKUP_IRQn);
+}
+
+// STOP mode until the wakeup timer has counted us
+static void _sampler_sleep(uint32_t us) {
+  // fits 32 bits for the longest conversion, 75 ms at x16 oversampling
+  uint32_t ticks = (us * SAMPLER_WUT_HZ + 999999) / 1000000;
+
+  if (ticks < 1) ticks = 1;
+  _sampler_rtc_unlock();
+  RTC->CR &= ~RTC_CR_WUTE;
+  while (!(RTC->ISR & RTC_ISR_WUTWF));
+  RTC->WUTR = ticks - 1;
+  RTC->ISR = ~(RTC_ISR_WUTF | RTC_ISR_INIT) | (RTC->ISR & RTC_ISR_INIT);
+  EXTI->PR = EXTI_PR_PR20;
+  _sampler_woken = 0;
+  RTC->CR |= RTC_CR_WUTIE | RTC_CR_WUTE;
+  _sampler_rtc_lock();
+
+  HAL_SuspendTick();
+  // WFI wakes on a pending interrupt with PRIMASK set, so the flag can not
+  // be set between the test and the sleep
+  __disable_irq();
+  while (!_sampler_woken) {
+    HAL_PWR_EnterSTOPMode(PWR_LOWPOWERREGULATOR_ON, PWR_STOPENTRY_WFI);
+    __enable_irq();
+    __disable_irq();
+  }
+  __enable_irq();
+  // STOP mode leaves the core on the MSI
+  SystemClock_Config();
+  HAL_ResumeTick();
+
+  _sampler_rtc_unlock();
+  RTC->CR &= ~(RTC_CR_WUTE | RTC_CR_WUTIE);
+  _sampler_rtc_lock();
+}
+
+int8_t sampler_init(struct bmp280_dev *dev, const struct bmp280_config *conf) {
+  int8_t rslt;
+
+  // bmp280_set_config() writes config and ctrl_meas and leaves the sensor asleep
+  rslt = bmp280_set_config(conf, dev);
+  if (rslt != BMP280_OK) return rslt;
+  _sampler_rtc_init();
+  return BMP280_OK;
+}
+
+// t_measure,max = 1.25 + 2.3 * osrs_t + (2.3 * osrs_p + 0.575) ms
+uint32_t sampler_meas_us(const struct bmp280_config *conf) {
+  uint32_t t = (1u << conf->os_temp) >> 1;
+  uint32_t p = (1u << conf->os_pres) >> 1;
+
+  return 1250 + 2300 * t + (p ? 2300 * p + 575 : 0);
+}
+
+int8_t sampler_read(struct bmp280_dev *dev, SAMPLER_RESULT *result) {
+  uint8_t reg = BMP280_CTRL_MEAS_ADDR, ctrl = 0, data[SAMPLER_BURST], i;
+  uint32_t us = sampler_meas_us(&dev->conf);
+  struct bmp280_uncomp_data raw;
+  int8_t rslt;
+
+  // ctrl_meas alone starts the conversion, config keeps what sampler_init() wrote
+  ctrl = BMP280_SET_BITS(ctrl, BMP280_OS_TEMP, dev->conf.os_temp);
+  ctrl = BMP280_SET_BITS(ctrl, BMP280_OS_PRES, dev->conf.os_pres);
+  ctrl = BMP280_SET_BITS_POS_0(ctrl, BMP280_POWER_MODE, BMP280_FORCED_MODE);
+  rslt = bmp280_set_regs(&reg, &ctrl, 1, dev);
+  if (rslt != BMP280_OK) return rslt;
+
+  _sampler_sleep(us);
+  // the LSI may run fast, nap again while the status still says measuring
+  for (i = 0; ; i++) {
+    rslt = bmp280_get_regs(BMP280_STATUS_ADDR, data, SAMPLER_BURST, dev);
+    if (rslt != BMP280_OK) return rslt;
+    if (!(data[0] & BMP280_STATUS_MEAS_MASK)) break;
+    if (i == SAMPLER_RETRIES) return SAMPLER_E_TIMEOUT;
+    _sampler_sleep(us / 4);
+  }
+
+  // 0xF7..0xFC: press msb, lsb, xlsb, temp msb, lsb, xlsb
+  raw.uncomp_press = ((uint32_t) data[4] << 12) | ((uint32_t) data[5] << 4) | (data[6] >> 4);
+  raw.uncomp_temp = (int32_t) (((uint32_t) data[7] << 12) | ((uint32_t) data[8] << 4)
+      | (data[9] >> 4));
+  if (raw.uncomp_temp <= BMP280_ST_ADC_T_MIN || raw.uncomp_temp >= BMP280_ST_ADC_T_MAX) {
+    return BMP280_E_UNCOMP_TEMP_RANGE;
+  }
+  rslt = bmp280_get_comp_temp_32bit(&result->Temperature, raw.uncomp_temp, dev);
+  if (rslt != BMP280_OK) return rslt;
+
+  result->Pressure = 0;
+  if (dev->conf.os_pres == BMP280_OS_NONE) return BMP280_OK;
+  if ((int32_t) raw.uncomp_press <= BMP280_ST_ADC_P_MIN
+      || (int32_t) raw.uncomp_press >= BMP280_ST_ADC_P_MAX) {
+    return BMP280_E_UNCOMP_PRES_RANGE;
+  }
+  return bmp280_get_comp_pres_32bit(&result->Pressure, raw.uncomp_press, dev);
+}
+
+void sampler_rtc_irq(void) {
+  if (RTC->ISR & RTC_ISR_WUTF) {
+    RTC->ISR = ~(RTC_ISR_WUTF | RTC_ISR_INIT) | (RTC->ISR & RTC_ISR_INIT);
+    _sampler_woken = 1;
+  }
+  EXTI->PR = EXTI_PR_PR20;
+}
@@ -0,0 +1,476 @@
+/*
+ * epdsim.c
+ *
+ * Runs Core/Src/epaper.c and display.c on the host against the SSD1680
+ * model and reports what every kind of screen update costs on the bus.
+ * After each step the image on the simulated glass is compared with the
+ * frame buffer, any difference or ignored byte makes the exit status 1.
+ *
+ * usage: epdsim [-o DIR] [-t TRACE]
+ *   -o DIR    write the glass after every step to DIR/NN-step.pbm
+ *   -t TRACE  log the decoded command stream, "-" for stdout
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "bmp.h"
+#include "display.h"
+#include "epdprof.h"
+#include "epdrefresh.h"
+#include "simasset.h"
+#include "ssd1680.h"
+
+// SPI1 with prescaler 4 from the 24 MHz system clock
+#define SIM_SPI_HZ 6000000UL
+
+#define SIM_STRIP_LINES 16
+
+static uint8_t frame[EPD_W_BUFF_SIZE * EPD_H];
+static uint8_t back[EPD_W_BUFF_SIZE * EPD_H];
+static uint8_t strip[EPD_W_BUFF_SIZE * SIM_STRIP_LINES];
+static uint8_t gray[EPD_GRAY_BUFF_SIZE * EPD_H];
+static uint8_t gray_strip[EPD_GRAY_BUFF_SIZE * SIM_STRIP_LINES];
+static int16_t history[48];
+static SPI_HandleTypeDef hspi1;
+#ifdef EPD_PROFILE
+static UART_HandleTypeDef huart1;
+#endif
+
+static int8_t w_temp, w_label, w_bar, w_chart;
+static const char *outdir;
+static int failed;
+
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin) {
+  if (GPIO_Pin == DISP_BUSY_Pin) epd_busy_irq();
+}
+
+// pixels where the glass differs from a full frame buffer
+static uint32_t sim_compare(const uint8_t *image) {
+  uint32_t bad = 0;
+  uint16_t x, y;
+
+  for (y = 0; y < EPD_H; y++) {
+    for (x = 0; x < EPD_W; x++) {
+      if (ssd1680_pixel(&sim_panel, x, EPD_H - 1 - y)
+          != (image[y * EPD_W_BUFF_SIZE + x / 8] >> (7 - x % 8) & 1)) bad++;
+    }
+  }
+  return bad;
+}
+
+// pixels where the old image RAM (0x26) differs from a full frame buffer
+static uint32_t sim_compare_old(const uint8_t *image) {
+  uint32_t bad = 0;
+  uint16_t x, y;
+
+  for (y = 0; y < EPD_H; y++) {
+    for (x = 0; x < EPD_W; x++) {
+      if ((sim_panel.red[EPD_H - 1 - y][x / 8] >> (7 - x % 8) & 1)
+          != (image[y * EPD_W_BUFF_SIZE + x / 8] >> (7 - x % 8) & 1)) bad++;
+    }
+  }
+  return bad;
+}
+
+// pixels where the RAM planes differ from a 2bpp frame buffer: the high
+// bit of a pixel belongs in 0x24, the low bit in 0x26
+static uint32_t sim_compare_gray(const uint8_t *image) {
+  uint32_t bad = 0;
+  uint16_t x, y;
+  uint8_t level;
+
+  for (y = 0; y < EPD_H; y++) {
+    for (x = 0; x < EPD_W; x++) {
+      level = image[y * EPD_GRAY_BUFF_SIZE + x / 4] >> (6 - x % 4 * 2) & 3;
+      if ((sim_panel.bw[EPD_H - 1 - y][x / 8] >> (7 - x % 8) & 1) != level >> 1
+          || (sim_panel.red[EPD_H - 1 - y][x / 8] >> (7 - x % 8) & 1) != (level & 1)) bad++;
+    }
+  }
+  return bad;
+}
+
+static void sim_report(const char *name, const SSD1680_STATS *before, uint32_t bad) {
+  static int n;
+  const SSD1680_STATS *s = &sim_panel.stats;
+  char path[256];
+  uint32_t bytes = s->bytes - before->bytes;
+  uint32_t errors = s->errors - before->errors;
+
+  printf("%-28s %7u %6u %7u %5u %4u %7u %7u.%u %7u %6u %s\n", name, bytes,
+      s->transfers - before->transfers, s->ram_bytes - before->ram_bytes,
+      s->lut_bytes - before->lut_bytes, s->full - before->full,
+      s->partial - before->partial, (unsigned) (bytes * 8 * 1000 / SIM_SPI_HZ),
+      (unsigned) (bytes * 8 * 10000 / SIM_SPI_HZ % 10), s->busy_ms - before->busy_ms, errors,
+      bad ? "MISMATCH" : "ok");
+  if (bad || errors) failed = 1;
+
+  n++;
+  if (outdir != NULL) {
+    snprintf(path, sizeof(path), "%s/%02d-%s.pbm", outdir, n, name);
+    for (char *p = path + strlen(outdir) + 1; *p; p++) {
+      if (*p == ' ' || *p == ',') *p = '-';
+    }
+    ssd1680_write_pbm(&sim_panel, path);
+  }
+}
+
+static void sim_step(const char *name, const SSD1680_STATS *before, const uint8_t *image) {
+  sim_report(name, before, image ? sim_compare(image) : 0);
+}
+
+static void sim_dashboard(void) {
+  uint8_t i;
+
+  for (i = 0; i < sizeof(history) / sizeof(history[0]); i++) {
+    history[i] = 180 + (i * 37) % 60 - i;
+  }
+  disp_init();
+  w_temp = disp_add_number(8, 8, 6, 1, 24, EPD_COLOR_BLACK);
+  w_label = disp_add_text(8, 40, 12, 16, EPD_COLOR_BLACK);
+  w_bar = disp_add_bar(8, 64, 120, 12, 0, 100, EPD_COLOR_BLACK);
+  w_chart = disp_add_chart(150, 8, 136, 100, history, 100, 300, EPD_COLOR_BLACK);
+  disp_set_unit(w_temp, "\x7F" "C");
+  disp_set_number(w_temp, 235);
+  disp_set_text(w_label, "1013 hPa");
+  disp_set_bar(w_bar, 45);
+  disp_set_chart(w_chart, sizeof(history) / sizeof(history[0]));
+}
+
+static void sim_render_all(void) {
+  epd_paint_clear(EPD_COLOR_WHITE);
+  disp_invalidate_all();
+  disp_render();
+}
+
+// pixels where epd_paint_showAsset() differs from epd_paint_showPicture()
+// on the source image, at a byte aligned and an unaligned position
+static uint32_t sim_compare_asset(uint16_t rotate, const EPD_ASSET *asset) {
+  static uint8_t ref[sizeof(frame)];
+  static const uint16_t pos[][2] = { { 0, 6 }, { 3, 0 } };
+  uint32_t bad = 0, i;
+  uint8_t k;
+
+  for (k = 0; k < 2; k++) {
+    epd_paint_newimage(frame, EPD_W, EPD_H, rotate, EPD_COLOR_WHITE);
+    epd_paint_clear(EPD_COLOR_BLACK);
+    epd_paint_showPicture(pos[k][0], pos[k][1], 250, 122, gImage_1, EPD_COLOR_WHITE);
+    // showPicture() also paints the padding rows of the last band
+    epd_paint_drawRectangle(pos[k][0] + 1, pos[k][1] + 123, pos[k][0] + 250, pos[k][1] + 129,
+        EPD_COLOR_BLACK, 1);
+    memcpy(ref, frame, sizeof(frame));
+    epd_paint_clear(EPD_COLOR_BLACK);
+    epd_paint_showAsset(pos[k][0], pos[k][1], asset);
+    for (i = 0; i < sizeof(frame); i++) {
+      bad += __builtin_popcount(ref[i] ^ frame[i]);
+    }
+  }
+  return bad;
+}
+
+static void sim_render_gray(void) {
+  static const uint16_t levels[] = { EPD_COLOR_BLACK, EPD_COLOR_DARKGRAY, EPD_COLOR_LIGHTGRAY,
+      EPD_COLOR_WHITE };
+  uint8_t i;
+
+  epd_paint_clear(EPD_COLOR_WHITE);
+  for (i = 0; i < 4; i++) {
+    epd_paint_drawRectangle(8 + 70 * i, 8, 70 + 70 * i, 60, levels[i], 1);
+  }
+  epd_paint_showString(8, 80, (uint8_t*) "4 gray", 24, EPD_COLOR_DARKGRAY);
+  epd_paint_drawCircle(200, 95, 20, EPD_COLOR_LIGHTGRAY, 1);
+}
+
+// gray text: on a 1bpp image the pixels of the rounded color, on a 2bpp
+// image only the gray level on white
+static uint32_t sim_compare_graytext(void) {
+  static uint8_t ref[sizeof(frame)];
+  static const uint16_t colors[][2] = { { EPD_COLOR_DARKGRAY, EPD_COLOR_BLACK },
+      { EPD_COLOR_LIGHTGRAY, EPD_COLOR_WHITE } };
+  uint32_t bad = 0, i;
+  uint16_t x, y;
+  uint8_t k, level;
+
+  epd_paint_newimage(frame, EPD_W, EPD_H, EPD_ROTATE_0, EPD_COLOR_WHITE);
+  for (k = 0; k < 2; k++) {
+    epd_paint_clear(EPD_COLOR_WHITE);
+    epd_paint_showString(8, 8, (uint8_t*) "88", 24, colors[k][1]);
+    memcpy(ref, frame, sizeof(frame));
+    epd_paint_clear(EPD_COLOR_WHITE);
+    epd_paint_showString(8, 8, (uint8_t*) "88", 24, colors[k][0]);
+    for (i = 0; i < sizeof(frame); i++) {
+      bad += __builtin_popcount(ref[i] ^ frame[i]);
+    }
+  }
+
+  epd_paint_newimage_gray(gray, EPD_W, EPD_H, EPD_ROTATE_0, EPD_COLOR_WHITE);
+  epd_paint_clear(EPD_COLOR_WHITE);
+  epd_paint_showString(8, 8, (uint8_t*) "88", 24, EPD_COLOR_DARKGRAY);
+  for (y = 0; y < EPD_H; y++) {
+    for (x = 0; x < EPD_W; x++) {
+      level = gray[y * EPD_GRAY_BUFF_SIZE + x / 4] >> (6 - x % 4 * 2) & 3;
+      if (level != 1 && level != 3) bad++;
+    }
+  }
+  return bad;
+}
+
+// pixels where a full bar differs from its solid box, and where a chart
+// moved from the bottom row to the top differs from drawing it again
+static uint32_t sim_compare_boxes(void) {
+  static uint8_t ref[sizeof(frame)];
+  static int16_t samples[8];
+  int8_t id;
+  uint32_t bad = 0, i;
+
+  epd_paint_newimage(frame, EPD_W, EPD_H, EPD_ROTATE_0, EPD_COLOR_WHITE);
+  epd_paint_clear(EPD_COLOR_WHITE);
+  disp_init();
+  id = disp_add_bar(10, 10, 50, 10, 0, 100, EPD_COLOR_BLACK);
+  disp_set_bar(id, 100);
+  disp_render();
+  memcpy(ref, frame, sizeof(frame));
+  epd_paint_clear(EPD_COLOR_WHITE);
+  epd_paint_drawRectangle(11, 11, 60, 21, EPD_COLOR_BLACK, 1);
+  for (i = 0; i < sizeof(frame); i++) {
+    bad += __builtin_popcount(ref[i] ^ frame[i]);
+  }
+
+  epd_paint_clear(EPD_COLOR_WHITE);
+  disp_init();
+  id = disp_add_chart(10, 40, 50, 20, samples, 0, 10, EPD_COLOR_BLACK);
+  disp_set_chart(id, 8);
+  disp_render();
+  for (i = 0; i < 8; i++) {
+    samples[i] = 10;
+  }
+  disp_invalidate(id);
+  disp_render();
+  memcpy(ref, frame, sizeof(frame));
+  sim_render_all();
+  for (i = 0; i < sizeof(frame); i++) {
+    bad += __builtin_popcount(ref[i] ^ frame[i]);
+  }
+  return bad;
+}
+
+// pixels where an incremental render of overlapping widgets differs from
+// drawing them all again
+static uint32_t sim_compare_overlap(void) {
+  static uint8_t ref[sizeof(frame)];
+  int8_t m, t, s;
+  uint32_t bad = 0, i;
+
+  epd_paint_newimage(frame, EPD_W, EPD_H, EPD_ROTATE_0, EPD_COLOR_WHITE);
+  epd_paint_clear(EPD_COLOR_WHITE);
+  disp_init();
+  m = disp_add_bar(8, 40, 60, 20, 0, 100, EPD_COLOR_BLACK);
+  t = disp_add_bar(50, 30, 40, 15, 0, 100, EPD_COLOR_BLACK);
+  s = disp_add_bar(8, 55, 30, 20, 0, 100, EPD_COLOR_BLACK);
+  disp_set_bar(m, 100);
+  disp_set_bar(t, 100);
+  disp_set_bar(s, 20);
+  disp_render();
+  disp_set_bar(s, 60);
+  disp_render();
+  memcpy(ref, frame, sizeof(frame));
+  sim_render_all();
+  for (i = 0; i < sizeof(frame); i++) {
+    bad += __builtin_popcount(ref[i] ^ frame[i]);
+  }
+  return bad;
+}
+
+int main(int argc, char **argv) {
+  SSD1680_STATS before;
+  uint32_t bad;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "o:t:")) != -1) {
+    switch (opt) {
+    case 'o':
+      outdir = optarg;
+      break;
+    case 't':
+      sim_panel.trace = strcmp(optarg, "-") ? fopen(optarg, "w") : stdout;
+      break;
+    default:
+      fprintf(stderr, "usage: %s [-o DIR] [-t TRACE]\n", argv[0]);
+      return 2;
+    }
+  }
+  ssd1680_init(&sim_panel, EPD_W, EPD_H);
+  epd_prof_init();
+
+  epd_pins.res_port = DISP_RESET_GPIO_Port;
+  epd_pins.res_pin = DISP_RESET_Pin;
+  epd_pins.busy_port = DISP_BUSY_GPIO_Port;
+  epd_pins.busy_pin = DISP_BUSY_Pin;
+  epd_pins.dc_port = DISP_DC_GPIO_Port;
+  epd_pins.dc_pin = DISP_DC_Pin;
+  epd_pins.cs_port = DISP_CS_GPIO_Port;
+  epd_pins.cs_pin = DISP_CS_Pin;
+  epd_pins.hspi = &hspi1;
+  epd_io_init();
+
+  printf("%-28s %7s %6s %7s %5s %4s %7s %9s %7s %6s\n", "step", "bytes", "xfers", "ram", "lut",
+      "full", "partial", "spi ms", "busy ms", "errors");
+
+  before = sim_panel.stats;
+  epd_init();
+  epd_paint_newimage(frame, EPD_W, EPD_H, EPD_ROTATE_0, EPD_COLOR_WHITE);
+  epd_paint_clear(EPD_COLOR_WHITE);
+  sim_dashboard();
+  disp_render();
+  epd_displayBW(frame);
+  sim_step("init, full dashboard", &before, frame);
+
+  before = sim_panel.stats;
+  epd_init_partial();
+  disp_set_number(w_temp, 236);
+  disp_refresh();
+  sim_step("partial, one number", &before, frame);
+
+  before = sim_panel.stats;
+  disp_set_number(w_temp, 236);
+  disp_refresh();
+  sim_step("partial, same number", &before, frame);
+
+  before = sim_panel.stats;
+  epd_displayBW_partial(frame);
+  sim_step("partial, identical frame", &before, frame);
+
+  before = sim_panel.stats;
+  history[47] = 290;
+  disp_set_chart(w_chart, sizeof(history) / sizeof(history[0]));
+  disp_set_bar(w_bar, 80);
+  disp_render();
+  epd_displayBW_partial(frame);
+  sim_step("partial, bar and chart", &before, frame);
+
+  before = sim_panel.stats;
+  epd_enter_deepsleepmode(EPD_DEEPSLEEP_MODE1);
+  epd_init_partial();
+  disp_set_text(w_label, "1009 hPa");
+  disp_refresh();
+  sim_step("sleep 1, wake, partial", &before, frame);
+
+  before = sim_panel.stats;
+  disp_set_style(w_label, EPD_TEXT_CENTER | EPD_TEXT_PROP);
+  disp_set_text(w_label, "998 hPa");
+  disp_refresh();
+  sim_step("partial, centered text", &before, frame);
+
+  before = sim_panel.stats;
+  epd_enter_deepsleepmode(EPD_DEEPSLEEP_MODE2);
+  epd_init();
+  epd_displayBW(frame);
+  sim_step("sleep 2, wake, full", &before, frame);
+
+  before = sim_panel.stats;
+  epd_paint_newimage(strip, EPD_W, EPD_H, EPD_ROTATE_0, EPD_COLOR_WHITE);
+  epd_paint_setband(0, SIM_STRIP_LINES);
+  epd_displayBW_banded(SIM_STRIP_LINES, sim_render_all);
+  sim_step("banded full, 16 rows", &before, frame);
+
+  before = sim_panel.stats;
+  epd_paint_newimage_gray(gray, EPD_W, EPD_H, EPD_ROTATE_0, EPD_COLOR_WHITE);
+  sim_render_gray();
+  epd_display_gray(gray);
+  sim_report("gray, full buffer", &before, sim_compare_gray(gray));
+
+  before = sim_panel.stats;
+  epd_paint_newimage_gray(gray_strip, EPD_W, EPD_H, EPD_ROTATE_0, EPD_COLOR_WHITE);
+  epd_paint_setband(0, SIM_STRIP_LINES);
+  epd_display_gray_banded(SIM_STRIP_LINES, sim_render_gray);
+  sim_report("gray banded, 16 rows", &before, sim_compare_gray(gray));
+
+  before = sim_panel.stats;
+  sim_report("gray text, 1 and 2 bpp", &before, sim_compare_graytext());
+
+  before = sim_panel.stats;
+  bad = sim_compare_asset(EPD_ROTATE_90, &epd_asset_raw);
+  bad += sim_compare_asset(EPD_ROTATE_90, &epd_asset_packed);
+  bad += sim_compare_asset(EPD_ROTATE_0, &epd_asset_packed);
+  bad += sim_compare_asset(EPD_ROTATE_0, &epd_asset_raw);
+  epd_init();
+  epd_displayBW(frame);
+  sim_report("asset, splash", &before, bad + sim_compare(frame));
+
+  // logical (0, EPD_W - 122) is memory (0, 0) at rotation 0
+  epd_paint_clear(EPD_COLOR_BLACK);
+  epd_displayBW(frame);
+  epd_paint_showAsset(0, EPD_W - epd_asset_raw.Height, &epd_asset_raw);
+  before = sim_panel.stats;
+  epd_display_asset(0, 0, &epd_asset_packed);
+  sim_step("asset, packed to RAM", &before, frame);
+
+  // a day of minute ticks through the refresh policy
+  before = sim_panel.stats;
+  epd_paint_newimage(frame, EPD_W, EPD_H, EPD_ROTATE_0, EPD_COLOR_WHITE);
+  sim_render_all();
+  epd_refresh_init();
+  for (int minute = 0; minute < 24 * 60; minute++) {
+    disp_set_number(w_temp, 200 + minute / 7 % 50);
+    disp_set_bar(w_bar, minute / 3 % 100);
+    disp_render();
+    while (epd_paint_isdirty()) {
+      HAL_Delay(100);
+      epd_refresh_poll();
+    }
+    HAL_Delay(60000);
+  }
+  sim_step("policy, 1440 minute ticks", &before, frame);
+
+  // the old image RAM is gone, the policy must not go partial
+  before = sim_panel.stats;
+  epd_enter_deepsleepmode(EPD_DEEPSLEEP_MODE2);
+  disp_set_number(w_temp, 199);
+  disp_render();
+  epd_refresh_now();
+  sim_step("sleep 2, wake, policy", &before, frame);
+
+  // each number is drawn into one buffer while the other one refreshes;
+  // a command sent while BUSY is high would show up as an error
+  before = sim_panel.stats;
+  epd_paint_doublebuffer(back);
+  for (int i = 0; i < 8; i++) {
+    disp_set_number(w_temp, 210 + i);
+    disp_render();
+    epd_displayBW_async(1);
+  }
+  epd_wait_update();
+  epd_paint_selectimage(frame);
+  epd_paint_doublebuffer(NULL);
+  sim_report("double buffer, 8 partials", &before, sim_compare(frame) + sim_compare_old(frame));
+
+  // a buffer that differs outside what is drawn next: selecting it makes
+  // the whole of it dirty, so the partial update catches the difference
+  before = sim_panel.stats;
+  memcpy(back, frame, sizeof(back));
+  memset(back + 100 * EPD_W_BUFF_SIZE, 0x00, 4 * EPD_W_BUFF_SIZE);
+  epd_paint_selectimage(back);
+  disp_set_number(w_temp, 230);
+  disp_render();
+  epd_displayBW_partial_dirty();
+  sim_step("other image, dirty partial", &before, back);
+  epd_paint_selectimage(frame);
+
+  // s overlaps m, m overlaps t: redrawing s clears m, whose box clear must
+  // bring back t as well
+  before = sim_panel.stats;
+  sim_report("widgets, full box clear", &before, sim_compare_boxes());
+
+  before = sim_panel.stats;
+  sim_report("widgets, overlap chain", &before, sim_compare_overlap());
+
+#ifdef EPD_PROFILE
+  epd_prof_dump(&huart1);
+#endif
+
+  if (sim_panel.trace != NULL) {
+    ssd1680_flush_trace(&sim_panel);
+    if (sim_panel.trace != stdout) fclose(sim_panel.trace);
+  }
+  return failed;
+}
@@ -0,0 +1,113 @@
+/*
+ * hal_shim.c
+ *
+ * Host implementation of the HAL calls used by epaper.c. Time is simulated:
+ * HAL_Delay() and __WFI() advance the clock, a refresh keeps BUSY high for
+ * SSD1680_FULL_MS / SSD1680_PARTIAL_MS and its falling edge is delivered
+ * through HAL_GPIO_EXTI_Callback() like EXTI15_10 does on the board.
+ */
+
+#include <stdio.h>
+#include "main.h"
+#include "ssd1680.h"
+
+GPIO_TypeDef sim_gpioa = { 'A' }, sim_gpiob = { 'B' }, sim_gpioc = { 'C' };
+
+SSD1680 sim_panel;
+
+DWT_Type sim_dwt;
+CoreDebug_Type sim_coredebug;
+uint32_t SystemCoreClock = 24000000;
+
+static uint32_t _now;
+static uint8_t _dc = 1, _cs = 1, _res = 1;
+static uint8_t _busy, _busy_irq;
+
+uint32_t sim_now(void) {
+  return _now;
+}
+
+static uint8_t _is(GPIO_TypeDef *port, uint16_t pin, GPIO_TypeDef *wport, uint16_t wpin) {
+  return port == wport && (pin & wpin);
+}
+
+// deliver the BUSY falling edge once the clock passed the end of a refresh
+static void _sim_edges(void) {
+  uint8_t busy = ssd1680_busy(&sim_panel, _now);
+
+  if (_busy && !busy && _busy_irq) HAL_GPIO_EXTI_Callback(DISP_BUSY_Pin);
+  _busy = busy;
+}
+
+static void _sim_cycles(uint32_t cycles) {
+  if (sim_dwt.CTRL & DWT_CTRL_CYCCNTENA_Msk) sim_dwt.CYCCNT += cycles;
+}
+
+static void _sim_advance(uint32_t ms) {
+  _now += ms;
+  _sim_cycles(ms * (SystemCoreClock / 1000));
+  _sim_edges();
+}
+
+void sim_wfi(void) {
+  if (ssd1680_busy(&sim_panel, _now)) _sim_advance(sim_panel.busy_until - _now);
+  else _sim_advance(1);
+}
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init) {
+  if (_is(GPIOx, GPIO_Init->Pin, DISP_BUSY_GPIO_Port, DISP_BUSY_Pin)) {
+    _busy_irq = GPIO_Init->Mode == GPIO_MODE_IT_FALLING;
+  }
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState) {
+  if (_is(GPIOx, GPIO_Pin, DISP_DC_GPIO_Port, DISP_DC_Pin)) _dc = PinState;
+  if (_is(GPIOx, GPIO_Pin, DISP_CS_GPIO_Port, DISP_CS_Pin)) _cs = PinState;
+  if (_is(GPIOx, GPIO_Pin, DISP_RESET_GPIO_Port, DISP_RESET_Pin)) {
+    if (!_res && PinState) ssd1680_hwreset(&sim_panel, _now);
+    _res = PinState;
+  }
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin) {
+  if (_is(GPIOx, GPIO_Pin, DISP_BUSY_GPIO_Port, DISP_BUSY_Pin)) {
+    return ssd1680_busy(&sim_panel, _now) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+  }
+  return GPIO_PIN_RESET;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size,
+    uint32_t Timeout) {
+  sim_panel.stats.transfers++;
+  _sim_cycles(Size * SIM_SPI_CYCLES);
+  while (Size--) {
+    if (_cs || !_res) sim_panel.stats.errors++;
+    else ssd1680_write(&sim_panel, _dc, *pData, _now);
+    pData++;
+  }
+  _sim_edges();
+  return HAL_OK;
+}
+
+// completes at once, HAL_SPI_GetState() is READY again on return
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size) {
+  return HAL_SPI_Transmit(hspi, pData, Size, 0);
+}
+
+HAL_SPI_StateTypeDef HAL_SPI_GetState(SPI_HandleTypeDef *hspi) {
+  return HAL_SPI_STATE_READY;
+}
+
+void HAL_Delay(uint32_t Delay) {
+  _sim_advance(Delay);
+}
+
+uint32_t HAL_GetTick(void) {
+  return _now;
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size,
+    uint32_t Timeout) {
+  fwrite(pData, 1, Size, stdout);
+  return HAL_OK;
+}
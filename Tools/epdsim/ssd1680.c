@@ -0,0 +1,237 @@
+/*
+ * ssd1680.c
+ *
+ * Byte level model of the SSD1680 e-paper controller, see ssd1680.h.
+ * Decoded: 0x01 0x10 0x11 0x12 0x20 0x22 0x24 0x26 0x32 0x44 0x45 0x4E 0x4F,
+ * every other command is counted and logged only.
+ */
+
+#include <string.h>
+#include "ssd1680.h"
+
+static void _regs_default(SSD1680 *dev) {
+  dev->entry = 0x03;
+  dev->xs = 0;
+  dev->xe = (dev->width + 7) / 8 - 1;
+  dev->ys = 0;
+  dev->ye = dev->height - 1;
+  dev->xc = 0;
+  dev->yc = 0;
+  dev->ctrl2 = 0xFF;
+  dev->lut_ram = 0;
+}
+
+void ssd1680_init(SSD1680 *dev, uint16_t width, uint16_t height) {
+  FILE *trace = dev->trace;
+
+  memset(dev, 0, sizeof(*dev));
+  dev->trace = trace;
+  dev->width = width;
+  dev->height = height;
+  memset(dev->bw, 0xFF, sizeof(dev->bw));
+  memset(dev->red, 0xFF, sizeof(dev->red));
+  memset(dev->shown, 0xFF, sizeof(dev->shown));
+  dev->cmd = 0xFF;
+  _regs_default(dev);
+}
+
+void ssd1680_flush_trace(SSD1680 *dev) {
+  uint16_t i;
+
+  if (dev->trace == NULL || dev->cmd == 0xFF || dev->traced) return;
+  dev->traced = 1;
+  fprintf(dev->trace, "%8u ms  %02X", dev->cmd_ms, dev->cmd);
+  if (dev->cmd == 0x24 || dev->cmd == 0x26 || dev->cmd == 0x32) {
+    fprintf(dev->trace, " [%u bytes]", dev->argc);
+  }
+  else {
+    for (i = 0; i < dev->argc && i < sizeof(dev->args); i++) {
+      fprintf(dev->trace, " %02X", dev->args[i]);
+    }
+    if (dev->argc > sizeof(dev->args)) fprintf(dev->trace, " ... [%u bytes]", dev->argc);
+  }
+  fprintf(dev->trace, "\n");
+}
+
+void ssd1680_hwreset(SSD1680 *dev, uint32_t now) {
+  ssd1680_flush_trace(dev);
+  if (dev->trace != NULL) fprintf(dev->trace, "%8u ms  -- hardware reset\n", now);
+  dev->cmd = 0xFF;
+  dev->sleep = 0;
+  _regs_default(dev);
+  dev->busy_until = now + SSD1680_RESET_MS;
+  dev->stats.resets++;
+}
+
+uint8_t ssd1680_busy(const SSD1680 *dev, uint32_t now) {
+  return now < dev->busy_until;
+}
+
+// move a counter one step from start towards end, 1 when it wrapped
+static uint8_t _step(uint16_t *c, uint16_t start, uint16_t end, uint8_t inc) {
+  if (*c == end) {
+    *c = start;
+    return 1;
+  }
+  *c = inc ? *c + 1 : *c - 1;
+  return 0;
+}
+
+static void _advance(SSD1680 *dev) {
+  uint16_t xc = dev->xc;
+
+  if (!(dev->entry & 0x04)) { // AM = 0: X first
+    if (_step(&xc, dev->xs, dev->xe, dev->entry & 0x01)) {
+      _step(&dev->yc, dev->ys, dev->ye, dev->entry & 0x02);
+    }
+  }
+  else if (_step(&dev->yc, dev->ys, dev->ye, dev->entry & 0x02)) {
+    _step(&xc, dev->xs, dev->xe, dev->entry & 0x01);
+  }
+  dev->xc = xc;
+}
+
+static void _refresh(SSD1680 *dev, uint32_t now) {
+  uint32_t ms = SSD1680_RESET_MS;
+
+  if (dev->ctrl2 & 0x10) dev->lut_ram = 0; // LUT reloaded from OTP
+  if (dev->ctrl2 & 0x04) {
+    if (dev->ctrl2 & 0x08) {
+      dev->stats.partial++;
+      ms = SSD1680_PARTIAL_MS;
+    }
+    else {
+      dev->stats.full++;
+      ms = SSD1680_FULL_MS;
+    }
+    memcpy(dev->shown, dev->bw, sizeof(dev->shown));
+  }
+  dev->busy_until = now + ms;
+  dev->stats.busy_ms += ms;
+  if (dev->trace != NULL) {
+    fprintf(dev->trace, "%8u ms  -- %s refresh, %s LUT\n", now,
+        !(dev->ctrl2 & 0x04) ? "no" : (dev->ctrl2 & 0x08) ? "partial" : "full",
+        dev->lut_ram ? "RAM" : "OTP");
+  }
+}
+
+static void _command(SSD1680 *dev, uint8_t cmd, uint32_t now) {
+  ssd1680_flush_trace(dev);
+  dev->stats.commands++;
+  dev->argc = 0;
+  dev->cmd = cmd;
+  dev->cmd_ms = now;
+  dev->traced = 0;
+  // a busy or sleeping controller ignores the interface
+  if (ssd1680_busy(dev, now) || dev->sleep) {
+    if (dev->trace != NULL) {
+      fprintf(dev->trace, "%8u ms  %02X ignored (%s)\n", now, cmd, dev->sleep ? "sleep" : "busy");
+    }
+    dev->stats.errors++;
+    dev->cmd = 0xFF;
+    return;
+  }
+
+  switch (cmd) {
+  case 0x12: // SWRESET, RAM is kept
+    _regs_default(dev);
+    dev->busy_until = now + SSD1680_RESET_MS;
+    dev->stats.resets++;
+    break;
+  case 0x20:
+    ssd1680_flush_trace(dev);
+    _refresh(dev, now);
+    break;
+  }
+}
+
+static void _data(SSD1680 *dev, uint8_t b) {
+  uint16_t n = dev->argc++;
+
+  if (dev->cmd == 0xFF) {
+    dev->stats.errors++;
+    return;
+  }
+  if (n < sizeof(dev->args)) dev->args[n] = b;
+
+  switch (dev->cmd) {
+  case 0x01: // driver output control, MUX = gates - 1
+    if (n == 1) {
+      dev->height = (dev->args[0] | (b & 0x01) << 8) + 1;
+      if (dev->height > SSD1680_YMAX) dev->height = SSD1680_YMAX;
+    }
+    break;
+  case 0x10:
+    if (n == 0) {
+      dev->sleep = b & 0x03;
+      dev->stats.sleeps++;
+      // deep sleep mode 2 does not retain the RAM
+      if (dev->sleep == 0x03) {
+        memset(dev->bw, 0x00, sizeof(dev->bw));
+        memset(dev->red, 0x00, sizeof(dev->red));
+      }
+    }
+    break;
+  case 0x11:
+    dev->entry = b & 0x07;
+    break;
+  case 0x22:
+    dev->ctrl2 = b;
+    break;
+  case 0x24:
+  case 0x26:
+    if (dev->xc < SSD1680_XBYTES && dev->yc < SSD1680_YMAX) {
+      (dev->cmd == 0x24 ? dev->bw : dev->red)[dev->yc][dev->xc] = b;
+    }
+    else {
+      dev->stats.errors++;
+    }
+    dev->stats.ram_bytes++;
+    _advance(dev);
+    break;
+  case 0x32:
+    dev->stats.lut_bytes++;
+    dev->lut_ram = 1;
+    break;
+  case 0x44:
+    if (n == 0) dev->xs = b & 0x3F;
+    if (n == 1) dev->xe = b & 0x3F;
+    break;
+  case 0x45:
+    if (n == 1) dev->ys = dev->args[0] | (b & 0x01) << 8;
+    if (n == 3) dev->ye = dev->args[2] | (b & 0x01) << 8;
+    break;
+  case 0x4E:
+    dev->xc = b & 0x3F;
+    break;
+  case 0x4F:
+    if (n == 1) dev->yc = dev->args[0] | (b & 0x01) << 8;
+    break;
+  }
+}
+
+void ssd1680_write(SSD1680 *dev, uint8_t dc, uint8_t byte, uint32_t now) {
+  dev->stats.bytes++;
+  if (!dc) _command(dev, byte, now);
+  else _data(dev, byte);
+}
+
+// 1 for a white pixel on the glass
+uint8_t ssd1680_pixel(const SSD1680 *dev, uint16_t x, uint16_t y) {
+  return dev->shown[y][x / 8] >> (7 - x % 8) & 1;
+}
+
+// the glass in RAM order: X to the right, RAM Y downwards
+int ssd1680_write_pbm(const SSD1680 *dev, const char *path) {
+  FILE *f = fopen(path, "wb");
+  uint16_t x, y;
+
+  if (f == NULL) return -1;
+  fprintf(f, "P4\n%u %u\n", dev->width, dev->height);
+  for (y = 0; y < dev->height; y++) {
+    for (x = 0; x < (dev->width + 7) / 8; x++) {
+      fputc(~dev->shown[y][x] & 0xFF, f); // PBM: 1 is black
+    }
+  }
+  return fclose(f);
+}
@@ -0,0 +1,70 @@
+/*
+ * ssd1680.h
+ *
+ * Byte level model of the SSD1680 e-paper controller for the host
+ * simulator: decodes the command stream, keeps both RAM planes and the
+ * image on the glass, and counts what it took to get there.
+ */
+
+#ifndef __SSD1680_H
+#define __SSD1680_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#define SSD1680_XBYTES 22  // 176 source outputs
+#define SSD1680_YMAX 296   // gate outputs
+
+// refresh times, only used to advance the simulated clock
+#define SSD1680_FULL_MS 2000
+#define SSD1680_PARTIAL_MS 350
+#define SSD1680_RESET_MS 2
+
+typedef struct {
+  uint32_t bytes;       // every byte clocked in with CS low
+  uint32_t commands;
+  uint32_t ram_bytes;   // 0x24 / 0x26 payload
+  uint32_t lut_bytes;   // 0x32 payload
+  uint32_t full;        // refreshes with display mode 1
+  uint32_t partial;     // refreshes with display mode 2
+  uint32_t busy_ms;     // time spent with BUSY high
+  uint32_t resets;      // hardware and software resets
+  uint32_t sleeps;
+  uint32_t errors;      // bytes the real controller would ignore
+  uint32_t transfers;   // HAL_SPI_Transmit(_DMA) calls, counted by the shim
+} SSD1680_STATS;
+
+typedef struct {
+  uint8_t bw[SSD1680_YMAX][SSD1680_XBYTES];   // 0x24
+  uint8_t red[SSD1680_YMAX][SSD1680_XBYTES];  // 0x26
+  uint8_t shown[SSD1680_YMAX][SSD1680_XBYTES]; // image on the glass
+  uint16_t width, height;
+  uint8_t entry;        // 0x11
+  uint8_t xs, xe, xc;   // 0x44 / 0x4E, in bytes
+  uint16_t ys, ye, yc;  // 0x45 / 0x4F
+  uint8_t ctrl2;        // 0x22
+  uint8_t lut_ram;      // LUT register holds data written with 0x32
+  uint8_t sleep;        // 0x10 mode, 0 when awake
+  uint8_t cmd;
+  uint8_t traced;       // cmd already written to the trace
+  uint32_t cmd_ms;
+  uint16_t argc;
+  uint8_t args[8];
+  uint32_t busy_until;  // simulated ms
+  SSD1680_STATS stats;
+  FILE *trace;          // command stream log, NULL for none
+} SSD1680;
+
+void ssd1680_init(SSD1680 *dev, uint16_t width, uint16_t height);
+void ssd1680_hwreset(SSD1680 *dev, uint32_t now);
+void ssd1680_write(SSD1680 *dev, uint8_t dc, uint8_t byte, uint32_t now);
+void ssd1680_flush_trace(SSD1680 *dev);
+uint8_t ssd1680_busy(const SSD1680 *dev, uint32_t now);
+uint8_t ssd1680_pixel(const SSD1680 *dev, uint16_t x, uint16_t y);
+int ssd1680_write_pbm(const SSD1680 *dev, const char *path);
+
+// panel behind the HAL shim (hal_shim.c), wired to the DISP_* pins of main.h
+extern SSD1680 sim_panel;
+uint32_t sim_now(void);
+
+#endif
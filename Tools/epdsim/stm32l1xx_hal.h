@@ -0,0 +1,134 @@
+/*
+ * stm32l1xx_hal.h
+ *
+ * Host stand-in for the STM32L1 HAL, just enough for epaper.c. It is found
+ * before the real driver through the include path of Tools/epdsim/Makefile;
+ * GPIO and SPI traffic goes to the SSD1680 model in ssd1680.c.
+ */
+
+#ifndef __STM32L1xx_HAL_H
+#define __STM32L1xx_HAL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef enum {
+  HAL_OK = 0x00U,
+  HAL_ERROR = 0x01U,
+  HAL_BUSY = 0x02U,
+  HAL_TIMEOUT = 0x03U
+} HAL_StatusTypeDef;
+
+typedef struct {
+  char Name;
+} GPIO_TypeDef;
+
+typedef enum {
+  GPIO_PIN_RESET = 0U,
+  GPIO_PIN_SET
+} GPIO_PinState;
+
+typedef struct {
+  uint32_t Pin;
+  uint32_t Mode;
+  uint32_t Pull;
+  uint32_t Speed;
+} GPIO_InitTypeDef;
+
+extern GPIO_TypeDef sim_gpioa, sim_gpiob, sim_gpioc;
+
+#define GPIOA (&sim_gpioa)
+#define GPIOB (&sim_gpiob)
+#define GPIOC (&sim_gpioc)
+
+#define GPIO_PIN_0 ((uint16_t)0x0001)
+#define GPIO_PIN_1 ((uint16_t)0x0002)
+#define GPIO_PIN_2 ((uint16_t)0x0004)
+#define GPIO_PIN_3 ((uint16_t)0x0008)
+#define GPIO_PIN_4 ((uint16_t)0x0010)
+#define GPIO_PIN_5 ((uint16_t)0x0020)
+#define GPIO_PIN_6 ((uint16_t)0x0040)
+#define GPIO_PIN_7 ((uint16_t)0x0080)
+#define GPIO_PIN_8 ((uint16_t)0x0100)
+#define GPIO_PIN_9 ((uint16_t)0x0200)
+#define GPIO_PIN_10 ((uint16_t)0x0400)
+#define GPIO_PIN_11 ((uint16_t)0x0800)
+#define GPIO_PIN_12 ((uint16_t)0x1000)
+#define GPIO_PIN_13 ((uint16_t)0x2000)
+#define GPIO_PIN_14 ((uint16_t)0x4000)
+#define GPIO_PIN_15 ((uint16_t)0x8000)
+
+#define GPIO_MODE_INPUT 0x00000000U
+#define GPIO_MODE_OUTPUT_PP 0x00000001U
+#define GPIO_MODE_IT_FALLING 0x10220000U
+#define GPIO_NOPULL 0x00000000U
+#define GPIO_PULLUP 0x00000001U
+#define GPIO_SPEED_FREQ_LOW 0x00000000U
+#define GPIO_SPEED_HIGH 0x00000002U
+
+typedef enum {
+  HAL_SPI_STATE_RESET = 0x00U,
+  HAL_SPI_STATE_READY = 0x01U,
+  HAL_SPI_STATE_BUSY_TX = 0x03U
+} HAL_SPI_StateTypeDef;
+
+typedef struct {
+  void *Instance;
+  void *hdmatx; // set to any non-NULL value to take the DMA path
+} SPI_HandleTypeDef;
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init);
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin);
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size,
+    uint32_t Timeout);
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size);
+HAL_SPI_StateTypeDef HAL_SPI_GetState(SPI_HandleTypeDef *hspi);
+
+void HAL_Delay(uint32_t Delay);
+uint32_t HAL_GetTick(void);
+
+typedef struct {
+  void *Instance;
+} UART_HandleTypeDef;
+
+// goes to stdout
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size,
+    uint32_t Timeout);
+
+// DWT cycle counter for EPD_PROFILE: SystemCoreClock cycles per simulated
+// ms plus SIM_SPI_CYCLES per SPI byte
+typedef struct {
+  volatile uint32_t CTRL;
+  volatile uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct {
+  volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+extern DWT_Type sim_dwt;
+extern CoreDebug_Type sim_coredebug;
+extern uint32_t SystemCoreClock;
+
+#define DWT (&sim_dwt)
+#define CoreDebug (&sim_coredebug)
+#define DWT_CTRL_CYCCNTENA_Msk 0x00000001U
+#define CoreDebug_DEMCR_TRCENA_Msk 0x01000000U
+#define SIM_SPI_CYCLES 32 // 8 bits, SPI1 prescaler 4
+
+// sleeps until the next simulated event (end of a refresh) or 1 ms
+void sim_wfi(void);
+#define __WFI() sim_wfi()
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,374 @@
+#!/usr/bin/env python3
+r"""
+fontconv.py
+
+Builds Core/Src/epdfont.c, the single definition of every font used by
+epaper.c, from the column-major source bitmaps in Tools/fonts/epdfont_src.h
+(asc2_0806, asc2_1206, asc2_1608, asc2_2412 and the Hzk CJK tables).
+
+ASCII glyphs are converted to the e-paper RAM layout of the requested
+rotation: a glyph is the list of memory rows its cell covers, each row
+running along the memory X axis, MSB first. Rows are then compressed:
+
+  glyph  := line0 nlines bit0 nbits  box
+  box    := nlines rows of nbits pixels, bit-packed without padding
+
+line0/nlines/bit0/nbits describe the smallest box holding the ink of the
+glyph inside its cell; the field widths are per font (LineField for the
+line pair, BitField for the bit pair). Glyphs follow each other in one
+bit stream, Index[] holds the bit offset of every EPD_FONT_INDEX_STEP-th
+glyph. Characters left out by --subset are stored as empty boxes.
+
+Code 0x7F is a degree sign drawn here, level with the top of the digits;
+"\x7F" in a C string, and a literal ° in --subset.
+
+For proportional text every size also gets the ink left edge and advance
+(ink width + 1) of each glyph, and a kerning table: for each pair of
+KERN_PAIRS (and --kern) the columns the right glyph can move left while
+keeping one blank column to the left glyph, row by row including the
+diagonal neighbours. Both are the same for every rotation.
+
+The Hzk tables are copied as they are, compiled only with EPD_FONT_CJK.
+
+usage: Tools/fontconv.py [--rotate 0 [90 180 270]]
+                         [--subset SIZE=CHARS ...] [--kern PAIRS] [-o epdfont.c] [source]
+
+example: Tools/fontconv.py --subset "24= +-.0123456789:%CFPahr°"
+"""
+
+import argparse
+import os
+import re
+import sys
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(__file__), '..'))
+
+# name, size1, cell width
+FONTS = [
+    ('asc2_0806', 8, 6),
+    ('asc2_1206', 12, 6),
+    ('asc2_1608', 16, 8),
+    ('asc2_2412', 24, 12),
+]
+
+CJK = ['Hzk1', 'Hzk2', 'Hzk3', 'Hzk4']
+
+ROTATIONS = (0, 90, 180, 270)
+
+FIRST_CHAR = 32
+
+DEGREE = 0x7F
+
+# degree sign per size1: column, pixel rows
+DEGREE_GLYPH = {
+    8: (1, ['.#.', '#.#', '.#.']),
+    12: (1, ['.##.', '#..#', '#..#', '.##.']),
+    16: (2, ['.##.', '#..#', '#..#', '.##.']),
+    24: (2, ['..##..', '.#..#.', '#....#', '#....#', '.#..#.', '..##..']),
+}
+
+# keep in sync with epdfont.h
+INDEX_STEP = 8
+
+# the usual suspects; pairs that come out without a gap to close are dropped
+KERN_PAIRS = ('AT AV AW AY Av Aw Ay FA F, F. LT LV LW LY Ly PA P, P. TA Ta Tc Te To Tr Tu '
+              'Tw Ty T, T. T- VA Va Ve Vo V, V. WA Wa We Wo W, W. YA Ya Ye Yo Y, Y. '
+              'r, r. y, y. 1. 7. L\' ').split()
+
+
+def strip_comments(text):
+    return re.sub(r'//[^\n]*|/\*.*?\*/', '', text, flags=re.S)
+
+
+def find_tables(text):
+    """Return {name: (declaration, body)} for every const table."""
+    tables = {}
+    for m in re.finditer(r'const\s+unsigned\s+char\s+(\w+)\s*(\[[^\]]*\]\s*\[[^\]]*\])\s*=\s*\{',
+                         text):
+        depth, i = 1, m.end()
+        while depth:
+            if text[i] == '{':
+                depth += 1
+            elif text[i] == '}':
+                depth -= 1
+            i += 1
+        tables[m.group(1)] = (m.group(2), text[m.end():i - 1])
+    return tables
+
+
+def parse_glyphs(body):
+    glyphs = []
+    for g in re.findall(r'\{([^}]*)\}', body):
+        glyphs.append([int(v, 0) for v in g.replace('\n', ' ').split(',') if v.strip()])
+    return glyphs
+
+
+def glyph_pixels(data, width, bands):
+    """Column-major bands, LSB on top -> pixel rows [y][x]."""
+    h = bands * 8
+    px = [[0] * width for _ in range(h)]
+    for i, byte in enumerate(data[:width * bands]):
+        band, x = divmod(i, width)
+        for bit in range(8):
+            if byte >> bit & 1:
+                px[band * 8 + bit][x] = 1
+    return px
+
+
+def native_shape(rotate, w, h):
+    """(lines, bits) of a w x h cell in memory space."""
+    return (w, h) if rotate in (0, 180) else (h, w)
+
+
+def native_pixel(rotate, w, h, line, bit):
+    """Glyph coordinate (gx, gy) stored at memory row `line`, bit `bit`."""
+    if rotate == 0:
+        return line, h - 1 - bit
+    if rotate == 90:
+        return w - 1 - bit, h - 1 - line
+    if rotate == 180:
+        return w - 1 - line, bit
+    return bit, line
+
+
+def degree_pixels(glyphs, size, width, bands):
+    """Degree sign in a cell, its top on the top row of the digit 0."""
+    zero = glyph_pixels(glyphs[ord('0') - FIRST_CHAR], width, bands)
+    top = min(y for y, row in enumerate(zero) if any(row))
+    x0, rows = DEGREE_GLYPH[size]
+    px = [[0] * width for _ in range(bands * 8)]
+    for y, row in enumerate(rows):
+        for x, c in enumerate(row):
+            px[top + y][x0 + x] = 1 if c == '#' else 0
+    return px
+
+
+def font_pixels(glyphs, size, w, bands, keep):
+    """Pixel rows of every code up to the degree sign, --subset applied."""
+    cells = []
+    for code in range(DEGREE - FIRST_CHAR + 1):
+        if keep is not None and chr(FIRST_CHAR + code) not in keep:
+            px = glyph_pixels([], w, bands)
+        elif FIRST_CHAR + code == DEGREE:
+            px = degree_pixels(glyphs, size, w, bands)
+        else:
+            # short tables leave the codes up to the degree sign empty
+            px = glyph_pixels(glyphs[code] if code < len(glyphs) else [], w, bands)
+        cells.append(px)
+    return cells
+
+
+def ink_columns(px):
+    xs = [x for row in px for x, v in enumerate(row) if v]
+    return (min(xs), max(xs)) if xs else None
+
+
+def metrics(cells, w):
+    """(ink left, advance) per glyph; blanks advance half a cell."""
+    out = []
+    for px in cells:
+        ink = ink_columns(px)
+        out.append((ink[0], ink[1] - ink[0] + 2) if ink else (0, max(2, w // 2)))
+    return out
+
+
+def kerning(cells, pairs):
+    """[(left, right, pixels)] sorted by left, right."""
+    def edges(px, pick):
+        return [pick(x for x, v in enumerate(row) if v) if any(row) else None for row in px]
+
+    out = []
+    for pair in sorted(set(pairs)):
+        a, b = (ord(c) - FIRST_CHAR for c in pair)
+        ia, ib = ink_columns(cells[a]), ink_columns(cells[b])
+        if ia is None or ib is None:
+            continue
+        right, left = edges(cells[a], max), edges(cells[b], min)
+        gap = None
+        for y, r in enumerate(right):
+            for yy in (y - 1, y, y + 1):
+                if r is None or not 0 <= yy < len(left) or left[yy] is None:
+                    continue
+                # blank columns between the two with the plain advance
+                g = (ia[1] - ia[0] + 2) + (left[yy] - ib[0]) - (r - ia[0]) - 1
+                gap = g if gap is None else min(gap, g)
+        if gap is not None and gap > 1:
+            out.append((FIRST_CHAR + a, FIRST_CHAR + b, gap - 1))
+    return out
+
+
+def field_width(n):
+    return max(1, n.bit_length())
+
+
+class BitWriter:
+    def __init__(self):
+        self.bits = []
+
+    def put(self, value, n):
+        for i in range(n - 1, -1, -1):
+            self.bits.append(value >> i & 1)
+
+    def tell(self):
+        return len(self.bits)
+
+    def bytes(self):
+        out = []
+        for i in range(0, len(self.bits), 8):
+            chunk = self.bits[i:i + 8]
+            chunk += [0] * (8 - len(chunk))
+            out.append(sum(b << (7 - k) for k, b in enumerate(chunk)))
+        return out
+
+
+def encode_glyph(bw, px, rotate, w, h, line_field, bit_field):
+    lines, bits = native_shape(rotate, w, h)
+    grid = [[0] * bits for _ in range(lines)]
+    for l in range(lines):
+        for b in range(bits):
+            gx, gy = native_pixel(rotate, w, h, l, b)
+            grid[l][b] = px[gy][gx]
+    ink = [(l, b) for l in range(lines) for b in range(bits) if grid[l][b]]
+    if not ink:
+        bw.put(0, line_field)
+        bw.put(0, line_field)
+        bw.put(0, bit_field)
+        bw.put(0, bit_field)
+        return
+    l0 = min(l for l, _ in ink)
+    l1 = max(l for l, _ in ink)
+    b0 = min(b for _, b in ink)
+    b1 = max(b for _, b in ink)
+    bw.put(l0, line_field)
+    bw.put(l1 - l0 + 1, line_field)
+    bw.put(b0, bit_field)
+    bw.put(b1 - b0 + 1, bit_field)
+    for l in range(l0, l1 + 1):
+        for b in range(b0, b1 + 1):
+            bw.put(grid[l][b], 1)
+
+
+def c_bytes(data, per_line=16, fmt='0x%02X'):
+    return ['  ' + ', '.join(fmt % b for b in data[i:i + per_line]) + ','
+            for i in range(0, len(data), per_line)]
+
+
+def emit(tables, rotations, subsets, kern, source):
+    out = []
+    out.append('/*')
+    out.append(' * epdfont.c')
+    out.append(' *')
+    out.append(' * Generated by Tools/fontconv.py from %s, do not edit.' % source)
+    out.append(' * Rotations: ' + ', '.join(str(r) for r in rotations))
+    for size in sorted(subsets):
+        chars = subsets[size].replace('*/', '* /').replace(chr(DEGREE), '\\x7F')
+        out.append(' * Subset %d: "%s"' % (size, chars))
+    out.append(' */')
+    out.append('')
+    out.append('#include "epdfont.h"')
+    out.append('')
+    entries = []
+    kern_count = {}
+    raw = packed = 0
+    for name, size, w in FONTS:
+        bands = size // 8 + (1 if size % 8 else 0)
+        cells = font_pixels(parse_glyphs(tables[name][1]), size, w, bands, subsets.get(size))
+        out.append('static const uint8_t epd_font%d_metrics[] = {' % size)
+        out += c_bytes([v for m in metrics(cells, w) for v in m], 16, '%d')
+        out.append('};')
+        out.append('')
+        pairs = kerning(cells, KERN_PAIRS + kern)
+        out.append('static const uint8_t epd_font%d_kern[] = {' % size)
+        out += c_bytes([v for k in pairs for v in k], 15, '%d') or ['  0,']
+        out.append('};')
+        out.append('')
+        packed += 2 * len(cells) + 3 * len(pairs)
+        kern_count[size] = len(pairs)
+    for rotate in rotations:
+        for name, size, w in FONTS:
+            glyphs = parse_glyphs(tables[name][1])
+            bands = size // 8 + (1 if size % 8 else 0)
+            h = bands * 8
+            lines, bits = native_shape(rotate, w, h)
+            line_field = field_width(lines)
+            bit_field = field_width(bits)
+            cells = font_pixels(glyphs, size, w, bands, subsets.get(size))
+            count = len(cells)
+            bw = BitWriter()
+            index = []
+            for code, px in enumerate(cells):
+                if code % INDEX_STEP == 0:
+                    index.append(bw.tell())
+                encode_glyph(bw, px, rotate, w, h, line_field, bit_field)
+            if bw.tell() > 0xFFFF:
+                sys.exit('fontconv: %s does not fit 16 bit offsets' % name)
+            data = bw.bytes()
+            raw += count * w * bands
+            packed += len(data) + 2 * len(index)
+            array = 'epd_font%d_r%d' % (size, rotate)
+            out.append('static const uint8_t %s_data[] = {' % array)
+            out += c_bytes(data)
+            out.append('};')
+            out.append('')
+            out.append('static const uint16_t %s_index[] = {' % array)
+            out += c_bytes(index, 8, '%d')
+            out.append('};')
+            out.append('')
+            entries.append('  { %d, %d, %d, %d, %d, %d, %d, %d, %d, %d, %s_index, %s_data,' %
+                           (size, w, h, rotate, lines, bits, line_field, bit_field, FIRST_CHAR,
+                            count, array, array))
+            entries.append('    epd_font%d_metrics, epd_font%d_kern, %d },' %
+                           (size, size, kern_count[size]))
+    out.append('const EPD_FONT epd_fonts[] = {')
+    out += entries
+    out.append('  { 0 },')
+    out.append('};')
+    out.append('')
+    out.append('#ifdef EPD_FONT_CJK')
+    out.append('')
+    for name in CJK:
+        decl, body = tables[name]
+        glyphs = parse_glyphs(body)
+        out.append('const unsigned char %s%s = {' % (name, decl))
+        for g in glyphs:
+            out.append('  {')
+            out += ['  ' + l for l in c_bytes(g)]
+            out.append('  },')
+        out.append('};')
+        out.append('')
+    out.append('#endif')
+    out.append('')
+    print('fontconv: %d bytes of ASCII glyphs packed into %d' % (raw, packed))
+    return '\n'.join(out)
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Build Core/Src/epdfont.c')
+    ap.add_argument('source', nargs='?',
+                    default=os.path.join(ROOT, 'Tools', 'fonts', 'epdfont_src.h'))
+    ap.add_argument('--rotate', nargs='+', type=int, default=[0], choices=ROTATIONS)
+    ap.add_argument('--subset', action='append', default=[], metavar='SIZE=CHARS',
+                    help='only keep CHARS of font SIZE, the others render blank')
+    ap.add_argument('--kern', default='', metavar='PAIRS',
+                    help='more character pairs to kern, separated by spaces')
+    ap.add_argument('-o', '--output', default=os.path.join(ROOT, 'Core', 'Src', 'epdfont.c'))
+    args = ap.parse_args()
+
+    subsets = {}
+    for item in args.subset:
+        size, _, chars = item.partition('=')
+        subsets[int(size)] = chars.replace('\u00b0', chr(DEGREE))
+
+    with open(args.source) as f:
+        tables = find_tables(strip_comments(f.read()))
+    for name in [f[0] for f in FONTS] + CJK:
+        if name not in tables:
+            sys.exit('fontconv: %s not found in %s' % (name, args.source))
+
+    source = os.path.relpath(args.source, ROOT).replace(os.sep, '/')
+    with open(args.output, 'w', newline='\n') as f:
+        f.write(emit(tables, sorted(set(args.rotate)), subsets, args.kern.split(), source))
+
+
+if __name__ == '__main__':
+    main()
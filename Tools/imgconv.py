@@ -0,0 +1,202 @@
+#!/usr/bin/env python3
+"""
+imgconv.py
+
+Builds Core/Src/epdasset.c and Core/Inc/epdasset.h: bitmaps stored in the
+e-paper RAM layout of one rotation, so epd_paint_showAsset() can copy them
+into the frame buffer row by row (memcpy when the box starts on a byte).
+
+An asset is the list of memory rows its w x h box covers, each row running
+along the memory X axis, MSB first, padded to whole bytes; 1 is white, as
+in the frame buffer. The layout is the one of the fonts, see fontconv.py.
+
+Assets named with --pack are stored as one PackBits stream over all rows:
+a header n < 128 is followed by n + 1 literal bytes, n > 128 by one byte
+repeated 257 - n times. epd_writeasset() decodes them straight into the
+SPI stream, epd_paint_showAsset() one row at a time.
+
+Sources:
+  NAME=FILE.pbm            plain (P1) or raw (P4) PBM, 1 is black
+  NAME=FILE.h:ARRAY:WxH    C array in the epd_paint_showPicture() layout:
+                           column-major bands of 8 rows, LSB on top, set
+                           bits are black
+Without sources the images of Core/Inc/bmp.h are converted and packed.
+
+usage: Tools/imgconv.py [--rotate 0|90|180|270] [--invert] [--pack NAME ...]
+                        [-o epdasset.c] [--header epdasset.h] [NAME=SOURCE ...]
+
+example: Tools/imgconv.py --rotate 90 --pack splash splash=art/splash.pbm sun=art/sun.pbm
+"""
+
+import argparse
+import os
+import re
+import sys
+
+sys.dont_write_bytecode = True
+from fontconv import ROOT, ROTATIONS, c_bytes, native_pixel, native_shape, strip_comments
+
+DEFAULT = ['image%d=Core/Inc/bmp.h:gImage_%d:250x122' % (i, i) for i in range(1, 5)]
+
+
+def read_pbm(path):
+    """PBM file -> pixel rows [y][x], 1 is black."""
+    with open(path, 'rb') as f:
+        data = f.read()
+    tokens = []
+    pos = 0
+    # magic, width, height, skipping comments
+    while len(tokens) < 3:
+        m = re.compile(rb'\s*(#[^\n]*\n\s*)*(\S+)').match(data, pos)
+        if m is None:
+            sys.exit('imgconv: %s: bad PBM header' % path)
+        tokens.append(m.group(2))
+        pos = m.end()
+    magic, w, h = tokens[0], int(tokens[1]), int(tokens[2])
+    if magic == b'P4':
+        pos += 1
+        stride = (w + 7) // 8
+        return [[data[pos + y * stride + x // 8] >> (7 - x % 8) & 1 for x in range(w)]
+                for y in range(h)]
+    if magic == b'P1':
+        bits = [int(c) for c in re.sub(rb'#[^\n]*', b'', data[pos:]).decode() if c in '01']
+        return [bits[y * w:(y + 1) * w] for y in range(h)]
+    sys.exit('imgconv: %s: only P1 and P4 PBM files are supported' % path)
+
+
+def read_array(path, array, w, h):
+    """showPicture() array -> pixel rows [y][x], 1 is black."""
+    with open(path) as f:
+        text = strip_comments(f.read())
+    m = re.search(r'\b%s\s*\[[^\]]*\]\s*=\s*\{([^}]*)\}' % re.escape(array), text)
+    if m is None:
+        sys.exit('imgconv: %s not found in %s' % (array, path))
+    data = [int(v, 0) for v in m.group(1).split(',') if v.strip()]
+    bands = (h + 7) // 8
+    if len(data) < w * bands:
+        sys.exit('imgconv: %s has %d bytes, %dx%d needs %d' % (array, len(data), w, h, w * bands))
+    px = [[0] * w for _ in range(h)]
+    for i, byte in enumerate(data[:w * bands]):
+        band, x = divmod(i, w)
+        for bit in range(8):
+            if band * 8 + bit < h:
+                px[band * 8 + bit][x] = byte >> bit & 1
+    return px
+
+
+def read_source(spec):
+    name, _, source = spec.partition('=')
+    if not re.match(r'^[A-Za-z_]\w*$', name) or not source:
+        sys.exit('imgconv: %s: expected NAME=SOURCE' % spec)
+    parts = source.split(':')
+    path = parts[0]
+    if not os.path.exists(path):
+        path = os.path.join(ROOT, path)
+    if len(parts) == 3:
+        w, _, h = parts[2].partition('x')
+        return name, source, read_array(path, parts[1], int(w), int(h))
+    return name, source, read_pbm(path)
+
+
+def encode(px, rotate, invert):
+    """Pixel rows -> (lines, bits, data) in memory layout, 1 is white."""
+    h, w = len(px), len(px[0])
+    lines, bits = native_shape(rotate, w, h)
+    data = []
+    for l in range(lines):
+        row = [0] * ((bits + 7) // 8)
+        for b in range(bits):
+            gx, gy = native_pixel(rotate, w, h, l, b)
+            if px[gy][gx] == invert:
+                row[b // 8] |= 0x80 >> (b % 8)
+        data += row
+    return lines, bits, data
+
+
+def packbits(data):
+    out = []
+    i, n = 0, len(data)
+    while i < n:
+        run = 1
+        while i + run < n and run < 128 and data[i + run] == data[i]:
+            run += 1
+        if run >= 2:
+            out += [257 - run, data[i]]
+            i += run
+            continue
+        # literals up to the next run of 3
+        j = i
+        while j < n and j - i < 128:
+            if j + 2 < n and data[j] == data[j + 1] == data[j + 2]:
+                break
+            j += 1
+        out += [j - i - 1] + data[i:j]
+        i = j
+    return out
+
+
+def emit(assets, rotate, output, header):
+    guard = '__%s_H' % os.path.splitext(os.path.basename(header))[0].upper()
+    c = ['/*', ' * ' + os.path.basename(output), ' *', ' * Generated by Tools/imgconv.py, do not edit.',
+         ' * Rotation: %d' % rotate]
+    for name, source, _ in assets:
+        c.append(' * %s: %s' % (name, source))
+    c += [' */', '', '#include "%s"' % os.path.basename(header), '']
+    h = ['/*', ' * ' + os.path.basename(header), ' *',
+         ' * Generated by Tools/imgconv.py, do not edit.', ' */', '',
+         '#ifndef ' + guard, '#define ' + guard, '', '#ifdef __cplusplus',
+         'extern "C" {', '#endif', '', '#include "epaper.h"', '']
+    total = raw = 0
+    for name, _, (width, height, lines, bits, data, packed) in assets:
+        array = 'epd_asset_%s' % name
+        c.append('static const uint8_t %s_data[] = {' % array)
+        c += c_bytes(data)
+        c.append('};')
+        c.append('')
+        c.append('const EPD_ASSET %s = { %d, %d, %d, %d, %d, %d, %s_data };' %
+                 (array, width, height, rotate, lines, bits, len(data) if packed else 0, array))
+        c.append('')
+        h.append('extern const EPD_ASSET %s;' % array)
+        total += len(data)
+        raw += lines * ((bits + 7) // 8)
+    h += ['', '#ifdef __cplusplus', '}', '#endif', '', '#endif', '']
+    print('imgconv: %d assets, %d bytes of rows stored in %d' % (len(assets), raw, total))
+    return '\n'.join(c), '\n'.join(h)
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Build Core/Src/epdasset.c')
+    ap.add_argument('assets', nargs='*', metavar='NAME=SOURCE', default=DEFAULT)
+    ap.add_argument('--rotate', type=int, default=0, choices=ROTATIONS,
+                    help='EPD_Paint rotation the assets are drawn with')
+    ap.add_argument('--invert', action='store_true', help='set source bits are white')
+    ap.add_argument('--pack', action='append', default=[], metavar='NAME',
+                    help='store asset NAME PackBits compressed')
+    ap.add_argument('-o', '--output', default=os.path.join(ROOT, 'Core', 'Src', 'epdasset.c'))
+    ap.add_argument('--header', default=os.path.join(ROOT, 'Core', 'Inc', 'epdasset.h'))
+    args = ap.parse_args()
+    if args.assets is DEFAULT and not args.pack:
+        args.pack = [spec.partition('=')[0] for spec in DEFAULT]
+
+    assets = []
+    for spec in args.assets:
+        name, source, px = read_source(spec)
+        if not px or not px[0]:
+            sys.exit('imgconv: %s is empty' % source)
+        lines, bits, data = encode(px, args.rotate, 1 if args.invert else 0)
+        packed = name in args.pack
+        if packed:
+            data = packbits(data)
+            if len(data) > 0xFFFF:
+                sys.exit('imgconv: %s does not fit 16 bit sizes' % name)
+        assets.append((name, source, (len(px[0]), len(px), lines, bits, data, packed)))
+
+    text, header = emit(assets, args.rotate, args.output, args.header)
+    with open(args.output, 'w', newline='\n') as f:
+        f.write(text)
+    with open(args.header, 'w', newline='\n') as f:
+        f.write(header)
+
+
+if __name__ == '__main__':
+    main()